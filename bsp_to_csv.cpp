@@ -0,0 +1,1350 @@
+// bsp_to_csv - native map item extractor for the map trainer
+//
+// Pulls the entity lump out of Quake 2 (IBSP v38) maps and writes the
+// trainer's item layout CSV for each one. Maps can be loose .bsp files or
+// live inside .pak/.pkz archives; every map found is processed in
+// parallel. Output is identical in layout to the old bsp_to_csv.py.
+//
+// Build (from a VS x64 developer prompt): build_bsp_to_csv.bat
+// Build (elsewhere): c++ -std=c++17 -O2 -pthread bsp_to_csv.cpp -o bsp_to_csv
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+/*
+============================================================================
+
+					MAPPED FILES
+
+============================================================================
+*/
+
+class mapped_file_t
+{
+public:
+	mapped_file_t() = default;
+	mapped_file_t(const mapped_file_t &) = delete;
+	mapped_file_t &operator=(const mapped_file_t &) = delete;
+
+	~mapped_file_t()
+	{
+#ifdef _WIN32
+		if (data_)
+			UnmapViewOfFile(data_);
+		if (mapping_)
+			CloseHandle(mapping_);
+		if (file_ != INVALID_HANDLE_VALUE)
+			CloseHandle(file_);
+#else
+		if (data_)
+			munmap(const_cast<uint8_t *>(data_), size_);
+		if (fd_ != -1)
+			close(fd_);
+#endif
+	}
+
+	bool open(const fs::path &path)
+	{
+#ifdef _WIN32
+		file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file_ == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file_, &size))
+			return false;
+		size_ = (size_t) size.QuadPart;
+
+		// can't map an empty file; leave it as a zero-length view
+		if (!size_)
+			return true;
+
+		mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping_)
+			return false;
+
+		data_ = (const uint8_t *) MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+		return data_ != nullptr;
+#else
+		fd_ = ::open(path.c_str(), O_RDONLY);
+		if (fd_ == -1)
+			return false;
+
+		struct stat st;
+		if (fstat(fd_, &st) == -1)
+			return false;
+		size_ = (size_t) st.st_size;
+
+		if (!size_)
+			return true;
+
+		void *view = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+		if (view == MAP_FAILED)
+			return false;
+
+		data_ = (const uint8_t *) view;
+		return true;
+#endif
+	}
+
+	const uint8_t *data() const { return data_; }
+	size_t		   size() const { return size_; }
+
+private:
+	const uint8_t *data_ = nullptr;
+	size_t		   size_ = 0;
+#ifdef _WIN32
+	HANDLE file_ = INVALID_HANDLE_VALUE;
+	HANDLE mapping_ = nullptr;
+#else
+	int fd_ = -1;
+#endif
+};
+
+static uint16_t read_le16(const uint8_t *p)
+{
+	return (uint16_t) (p[0] | (p[1] << 8));
+}
+
+static uint32_t read_le32(const uint8_t *p)
+{
+	return (uint32_t) p[0] | ((uint32_t) p[1] << 8) | ((uint32_t) p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static bool equals_nocase(std::string_view a, std::string_view b)
+{
+	return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(),
+		[](char x, char y) { return tolower((unsigned char) x) == tolower((unsigned char) y); });
+}
+
+static bool ends_with_nocase(std::string_view s, std::string_view suffix)
+{
+	return s.size() >= suffix.size() && equals_nocase(s.substr(s.size() - suffix.size()), suffix);
+}
+
+/*
+============================================================================
+
+					INFLATE
+
+Minimal raw deflate decoder (RFC 1951) for compressed .pkz members;
+canonical Huffman decoding in the style of zlib's "puff".
+
+============================================================================
+*/
+
+namespace inflate
+{
+	constexpr int MAX_BITS = 15;
+
+	struct huffman_t
+	{
+		int16_t count[MAX_BITS + 1];
+		int16_t symbol[288];
+	};
+
+	struct state_t
+	{
+		const uint8_t		 *in;
+		size_t				  in_len;
+		size_t				  in_pos = 0;
+		uint32_t			  bitbuf = 0;
+		int					  bitcnt = 0;
+		std::vector<uint8_t> &out;
+	};
+
+	static int bits(state_t &s, int need)
+	{
+		uint32_t val = s.bitbuf;
+
+		while (s.bitcnt < need)
+		{
+			if (s.in_pos == s.in_len)
+				throw std::runtime_error("deflate stream ended early");
+
+			val |= (uint32_t) s.in[s.in_pos++] << s.bitcnt;
+			s.bitcnt += 8;
+		}
+
+		s.bitbuf = (uint32_t) ((uint64_t) val >> need);
+		s.bitcnt -= need;
+
+		return (int) (val & ((1u << need) - 1));
+	}
+
+	static void construct(huffman_t &h, const int16_t *length, int n)
+	{
+		int16_t offs[MAX_BITS + 1];
+
+		std::fill(std::begin(h.count), std::end(h.count), 0);
+
+		for (int symbol = 0; symbol < n; symbol++)
+			h.count[length[symbol]]++;
+
+		offs[1] = 0;
+		for (int len = 1; len < MAX_BITS; len++)
+			offs[len + 1] = offs[len] + h.count[len];
+
+		for (int symbol = 0; symbol < n; symbol++)
+			if (length[symbol])
+				h.symbol[offs[length[symbol]]++] = (int16_t) symbol;
+	}
+
+	static int decode(state_t &s, const huffman_t &h)
+	{
+		int code = 0, first = 0, index = 0;
+
+		for (int len = 1; len <= MAX_BITS; len++)
+		{
+			code |= bits(s, 1);
+			int count = h.count[len];
+
+			if (code - count < first)
+				return h.symbol[index + (code - first)];
+
+			index += count;
+			first += count;
+			first <<= 1;
+			code <<= 1;
+		}
+
+		throw std::runtime_error("bad deflate code");
+	}
+
+	static void codes(state_t &s, const huffman_t &lencode, const huffman_t &distcode)
+	{
+		static constexpr int16_t lbase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+			35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+		static constexpr int16_t lext[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+			3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+		static constexpr int16_t dbase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+			257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+		static constexpr int16_t dext[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+			7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+		while (true)
+		{
+			int symbol = decode(s, lencode);
+
+			if (symbol < 256)
+			{
+				s.out.push_back((uint8_t) symbol);
+				continue;
+			}
+
+			if (symbol == 256)
+				return;
+
+			symbol -= 257;
+			if (symbol >= 29)
+				throw std::runtime_error("bad deflate length");
+
+			size_t len = lbase[symbol] + bits(s, lext[symbol]);
+
+			symbol = decode(s, distcode);
+			if (symbol >= 30)
+				throw std::runtime_error("bad deflate distance");
+
+			size_t dist = dbase[symbol] + bits(s, dext[symbol]);
+			if (dist > s.out.size())
+				throw std::runtime_error("deflate distance too far back");
+
+			// may overlap what's being written, so byte at a time
+			size_t from = s.out.size() - dist;
+			for (size_t i = 0; i < len; i++)
+				s.out.push_back(s.out[from + i]);
+		}
+	}
+
+	static void stored(state_t &s)
+	{
+		// discard leftover bits from the current byte
+		s.bitbuf = 0;
+		s.bitcnt = 0;
+
+		if (s.in_pos + 4 > s.in_len)
+			throw std::runtime_error("deflate stream ended early");
+
+		uint16_t len = read_le16(s.in + s.in_pos);
+		uint16_t nlen = read_le16(s.in + s.in_pos + 2);
+		s.in_pos += 4;
+
+		if (len != (uint16_t) ~nlen || s.in_pos + len > s.in_len)
+			throw std::runtime_error("bad stored block");
+
+		s.out.insert(s.out.end(), s.in + s.in_pos, s.in + s.in_pos + len);
+		s.in_pos += len;
+	}
+
+	static void fixed(state_t &s)
+	{
+		static const auto tables = []() {
+			std::pair<huffman_t, huffman_t> t;
+			int16_t							lengths[288];
+
+			for (int i = 0; i < 144; i++)
+				lengths[i] = 8;
+			for (int i = 144; i < 256; i++)
+				lengths[i] = 9;
+			for (int i = 256; i < 280; i++)
+				lengths[i] = 7;
+			for (int i = 280; i < 288; i++)
+				lengths[i] = 8;
+			construct(t.first, lengths, 288);
+
+			for (int i = 0; i < 30; i++)
+				lengths[i] = 5;
+			construct(t.second, lengths, 30);
+
+			return t;
+		}();
+
+		codes(s, tables.first, tables.second);
+	}
+
+	static void dynamic(state_t &s)
+	{
+		static constexpr uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+		int nlen = bits(s, 5) + 257;
+		int ndist = bits(s, 5) + 1;
+		int ncode = bits(s, 4) + 4;
+
+		if (nlen > 286 || ndist > 30)
+			throw std::runtime_error("bad deflate counts");
+
+		int16_t	  lengths[286 + 30] = {};
+		huffman_t lencode, distcode;
+
+		for (int i = 0; i < ncode; i++)
+			lengths[order[i]] = (int16_t) bits(s, 3);
+
+		construct(lencode, lengths, 19);
+
+		for (int index = 0; index < nlen + ndist;)
+		{
+			int symbol = decode(s, lencode);
+
+			if (symbol < 16)
+			{
+				lengths[index++] = (int16_t) symbol;
+				continue;
+			}
+
+			int16_t len = 0;
+
+			if (symbol == 16)
+			{
+				if (!index)
+					throw std::runtime_error("deflate repeat with no length");
+				len = lengths[index - 1];
+				symbol = 3 + bits(s, 2);
+			}
+			else if (symbol == 17)
+				symbol = 3 + bits(s, 3);
+			else
+				symbol = 11 + bits(s, 7);
+
+			if (index + symbol > nlen + ndist)
+				throw std::runtime_error("too many deflate lengths");
+
+			while (symbol--)
+				lengths[index++] = len;
+		}
+
+		if (!lengths[256])
+			throw std::runtime_error("deflate block has no end code");
+
+		construct(lencode, lengths, nlen);
+		construct(distcode, lengths + nlen, ndist);
+
+		codes(s, lencode, distcode);
+	}
+
+	static void run(const uint8_t *in, size_t in_len, std::vector<uint8_t> &out)
+	{
+		state_t s { in, in_len, 0, 0, 0, out };
+		int		last;
+
+		do
+		{
+			last = bits(s, 1);
+
+			switch (bits(s, 2))
+			{
+			case 0:
+				stored(s);
+				break;
+			case 1:
+				fixed(s);
+				break;
+			case 2:
+				dynamic(s);
+				break;
+			default:
+				throw std::runtime_error("bad deflate block type");
+			}
+		} while (!last);
+	}
+} // namespace inflate
+
+/*
+============================================================================
+
+					MAP SOURCES
+
+A map is a byte range in a mapped file: the whole of a loose .bsp, or
+one member of a .pak/.pkz. Compressed members are inflated by the worker
+that processes them.
+
+============================================================================
+*/
+
+struct map_source_t
+{
+	std::shared_ptr<mapped_file_t> file;
+	std::string					   display;	 // for messages
+	std::string					   map_name; // bsp filename without extension
+	size_t						   offset = 0;
+	size_t						   length = 0;
+	size_t						   uncompressed_length = 0;
+	bool						   deflated = false;
+};
+
+static std::string map_name_from_path(std::string_view path)
+{
+	size_t slash = path.find_last_of("/\\");
+	if (slash != std::string_view::npos)
+		path.remove_prefix(slash + 1);
+
+	size_t dot = path.find_last_of('.');
+	if (dot != std::string_view::npos)
+		path.remove_suffix(path.size() - dot);
+
+	return std::string(path);
+}
+
+// archive members count as maps if they're a .bsp under a maps/ directory
+static bool is_map_member(std::string_view name)
+{
+	if (!ends_with_nocase(name, ".bsp"))
+		return false;
+
+	for (size_t i = 0; i + 5 <= name.size(); i++)
+	{
+		if ((i == 0 || name[i - 1] == '/' || name[i - 1] == '\\') &&
+			equals_nocase(name.substr(i, 4), "maps") && (name[i + 4] == '/' || name[i + 4] == '\\'))
+			return true;
+	}
+
+	return false;
+}
+
+/*
+=================
+pak_list_maps
+
+id PACK archive: "PACK", directory offset, directory length;
+each directory entry is a 56 byte name, offset and length.
+=================
+*/
+static void pak_list_maps(const std::shared_ptr<mapped_file_t> &file, const std::string &display, std::vector<map_source_t> &out)
+{
+	const uint8_t *data = file->data();
+	size_t		   size = file->size();
+
+	if (size < 12 || memcmp(data, "PACK", 4))
+		throw std::runtime_error("not a pak file");
+
+	size_t dir_offset = read_le32(data + 4);
+	size_t dir_length = read_le32(data + 8);
+
+	if (dir_offset > size || dir_length > size - dir_offset)
+		throw std::runtime_error("pak directory out of range");
+
+	constexpr size_t PAK_ENTRY_SIZE = 64;
+
+	for (size_t i = 0; i + PAK_ENTRY_SIZE <= dir_length; i += PAK_ENTRY_SIZE)
+	{
+		const uint8_t *entry = data + dir_offset + i;
+		std::string_view name((const char *) entry, strnlen((const char *) entry, 56));
+
+		if (!is_map_member(name))
+			continue;
+
+		map_source_t source;
+		source.file = file;
+		source.display = display + ":" + std::string(name);
+		source.map_name = map_name_from_path(name);
+		source.offset = read_le32(entry + 56);
+		source.length = read_le32(entry + 60);
+		out.push_back(std::move(source));
+	}
+}
+
+/*
+=================
+zip_list_maps
+
+.pkz is a plain zip; walk the central directory and
+resolve each map's local header to find its data.
+Only stored and deflated members are supported.
+=================
+*/
+static void zip_list_maps(const std::shared_ptr<mapped_file_t> &file, const std::string &display, std::vector<map_source_t> &out)
+{
+	const uint8_t *data = file->data();
+	size_t		   size = file->size();
+
+	constexpr size_t EOCD_SIZE = 22;
+
+	if (size < EOCD_SIZE)
+		throw std::runtime_error("not a zip file");
+
+	// the end of central directory record sits behind an optional comment
+	size_t eocd = SIZE_MAX;
+	size_t lowest = size > EOCD_SIZE + 0xFFFF ? size - EOCD_SIZE - 0xFFFF : 0;
+
+	for (size_t i = size - EOCD_SIZE + 1; i-- > lowest;)
+	{
+		if (read_le32(data + i) == 0x06054b50)
+		{
+			eocd = i;
+			break;
+		}
+	}
+
+	if (eocd == SIZE_MAX)
+		throw std::runtime_error("zip central directory not found");
+
+	size_t num_entries = read_le16(data + eocd + 10);
+	size_t cd_offset = read_le32(data + eocd + 16);
+	size_t pos = cd_offset;
+
+	for (size_t i = 0; i < num_entries; i++)
+	{
+		if (pos + 46 > size || read_le32(data + pos) != 0x02014b50)
+			throw std::runtime_error("bad zip central directory");
+
+		const uint8_t *entry = data + pos;
+		uint16_t	   method = read_le16(entry + 10);
+		size_t		   compressed = read_le32(entry + 20);
+		size_t		   uncompressed = read_le32(entry + 24);
+		size_t		   name_len = read_le16(entry + 28);
+		size_t		   extra_len = read_le16(entry + 30);
+		size_t		   comment_len = read_le16(entry + 32);
+		size_t		   local = read_le32(entry + 42);
+
+		if (pos + 46 + name_len > size)
+			throw std::runtime_error("bad zip central directory");
+
+		std::string_view name((const char *) entry + 46, name_len);
+		pos += 46 + name_len + extra_len + comment_len;
+
+		if (!is_map_member(name))
+			continue;
+
+		if (method != 0 && method != 8)
+		{
+			fprintf(stderr, "Skipping %s:%.*s: unsupported compression method %u\n", display.c_str(), (int) name.size(), name.data(), method);
+			continue;
+		}
+
+		if (local + 30 > size || read_le32(data + local) != 0x04034b50)
+			throw std::runtime_error("bad zip local header");
+
+		map_source_t source;
+		source.file = file;
+		source.display = display + ":" + std::string(name);
+		source.map_name = map_name_from_path(name);
+		source.offset = local + 30 + read_le16(data + local + 26) + read_le16(data + local + 28);
+		source.length = compressed;
+		source.uncompressed_length = uncompressed;
+		source.deflated = method == 8;
+		out.push_back(std::move(source));
+	}
+}
+
+/*
+============================================================================
+
+					ENTITY LUMP
+
+============================================================================
+*/
+
+constexpr int BSP_VERSION = 38;
+constexpr int BSP_NUM_LUMPS = 19;
+constexpr int LUMP_ENTITIES = 0;
+
+static std::string_view bsp_entity_lump(const uint8_t *data, size_t size)
+{
+	if (size < 8 + BSP_NUM_LUMPS * 8 || memcmp(data, "IBSP", 4) || (int32_t) read_le32(data + 4) != BSP_VERSION)
+		throw std::runtime_error("Invalid Q2 BSP file");
+
+	const uint8_t *lump = data + 8 + LUMP_ENTITIES * 8;
+	size_t		   offset = read_le32(lump);
+	size_t		   length = read_le32(lump + 4);
+
+	if (offset > size || length > size - offset)
+		throw std::runtime_error("entity lump out of range");
+
+	std::string_view entities((const char *) data + offset, length);
+
+	// the lump is usually NUL terminated
+	size_t nul = entities.find('\0');
+	if (nul != std::string_view::npos)
+		entities.remove_suffix(entities.size() - nul);
+
+	return entities;
+}
+
+/*
+=================
+entity_tokenizer_t
+
+Same rules as COM_Parse: whitespace separated words, quoted strings
+run to the next quote, and // comments run to end of line. Tokens are
+views into the lump; nothing is copied.
+=================
+*/
+struct entity_tokenizer_t
+{
+	std::string_view data;
+	size_t			 pos = 0;
+
+	static bool is_separator(char c)
+	{
+		return c == '\r' || c == '\n' || c == '\t' || c == ' ';
+	}
+
+	// false at end of data
+	bool next(std::string_view &token)
+	{
+		while (true)
+		{
+			while (pos < data.size() && is_separator(data[pos]))
+				pos++;
+
+			if (pos >= data.size())
+				return false;
+
+			if (data[pos] == '/' && pos + 1 < data.size() && data[pos + 1] == '/')
+			{
+				while (pos < data.size() && data[pos] != '\n')
+					pos++;
+				continue;
+			}
+
+			break;
+		}
+
+		if (data[pos] == '\"')
+		{
+			size_t start = ++pos;
+			size_t end = data.find('\"', start);
+
+			if (end == std::string_view::npos)
+				end = data.size();
+
+			token = data.substr(start, end - start);
+			pos = std::min(end + 1, data.size());
+			return true;
+		}
+
+		size_t start = pos;
+		while (pos < data.size() && !is_separator(data[pos]))
+			pos++;
+
+		token = data.substr(start, pos - start);
+		return true;
+	}
+};
+
+struct entity_t
+{
+	std::vector<std::pair<std::string_view, std::string_view>> pairs;
+
+	// later keys override earlier ones, as in ED_ParseField
+	std::string_view get(std::string_view key) const
+	{
+		for (auto it = pairs.rbegin(); it != pairs.rend(); ++it)
+			if (it->first == key)
+				return it->second;
+
+		return {};
+	}
+};
+
+/*
+=================
+parse_entities
+
+Mirrors ED_LoadFromFile/ED_ParseEdict, including where they error.
+=================
+*/
+static std::vector<entity_t> parse_entities(std::string_view lump)
+{
+	std::vector<entity_t> entities;
+	entity_tokenizer_t	  tokens { lump };
+	std::string_view	  token;
+
+	while (tokens.next(token))
+	{
+		if (token.empty() || token[0] != '{')
+			throw std::runtime_error("found " + std::string(token) + " when expecting {");
+
+		entity_t &ent = entities.emplace_back();
+
+		while (true)
+		{
+			std::string_view key, value;
+
+			if (!tokens.next(key))
+				throw std::runtime_error("EOF without closing brace");
+			if (!key.empty() && key[0] == '}')
+				break;
+
+			if (!tokens.next(value))
+				throw std::runtime_error("EOF without closing brace");
+			if (!value.empty() && value[0] == '}')
+				throw std::runtime_error("closing brace without data");
+
+			// keynames with a leading underscore are utility comments
+			if (!key.empty() && key[0] == '_')
+				continue;
+
+			ent.pairs.emplace_back(key, value);
+		}
+	}
+
+	return entities;
+}
+
+/*
+============================================================================
+
+					ITEM MAP
+
+item_map.json gives each classname a friendly name and a type. Only a
+small subset of JSON is needed: objects, strings, and skipping anything
+else.
+
+============================================================================
+*/
+
+struct item_info_t
+{
+	std::string name;
+	std::string type;
+};
+
+struct json_reader_t
+{
+	std::string_view text;
+	size_t			 pos = 0;
+
+	void skip_ws()
+	{
+		while (pos < text.size() && isspace((unsigned char) text[pos]))
+			pos++;
+	}
+
+	bool accept(char c)
+	{
+		skip_ws();
+		if (pos < text.size() && text[pos] == c)
+		{
+			pos++;
+			return true;
+		}
+		return false;
+	}
+
+	void expect(char c)
+	{
+		if (!accept(c))
+			throw std::runtime_error(std::string("expected '") + c + "' in item_map.json");
+	}
+
+	std::string string()
+	{
+		expect('\"');
+
+		std::string out;
+
+		while (pos < text.size() && text[pos] != '\"')
+		{
+			char c = text[pos++];
+
+			if (c == '\\' && pos < text.size())
+			{
+				c = text[pos++];
+
+				switch (c)
+				{
+				case 'n': c = '\n'; break;
+				case 't': c = '\t'; break;
+				case 'r': c = '\r'; break;
+				case 'b': c = '\b'; break;
+				case 'f': c = '\f'; break;
+				case 'u':
+					// names are ASCII; anything else becomes '?'
+					if (pos + 4 > text.size())
+						throw std::runtime_error("bad escape in item_map.json");
+					c = (char) strtol(std::string(text.substr(pos, 4)).c_str(), nullptr, 16);
+					if ((unsigned char) c > 0x7F || !c)
+						c = '?';
+					pos += 4;
+					break;
+				default: break; // \" \\ \/
+				}
+			}
+
+			out.push_back(c);
+		}
+
+		expect('\"');
+		return out;
+	}
+
+	// calls member(key) for each member; member must consume the value
+	template<typename F>
+	void object(F member)
+	{
+		expect('{');
+
+		if (accept('}'))
+			return;
+
+		do
+		{
+			std::string key = string();
+			expect(':');
+			member(key);
+		} while (accept(','));
+
+		expect('}');
+	}
+
+	void skip_value()
+	{
+		skip_ws();
+
+		if (pos >= text.size())
+			throw std::runtime_error("unexpected end of item_map.json");
+
+		if (text[pos] == '{')
+			object([this](const std::string &) { skip_value(); });
+		else if (text[pos] == '[')
+		{
+			expect('[');
+			if (!accept(']'))
+			{
+				do
+					skip_value();
+				while (accept(','));
+				expect(']');
+			}
+		}
+		else if (text[pos] == '\"')
+			string();
+		else
+		{
+			while (pos < text.size() && !strchr(",}] \t\r\n", text[pos]))
+				pos++;
+		}
+	}
+};
+
+static std::unordered_map<std::string, item_info_t> load_item_map(const fs::path &path, const char *game)
+{
+	std::ifstream file(path, std::ios::binary);
+
+	if (!file)
+		throw std::runtime_error("item_map.json not found. Please ensure the file exists.");
+
+	std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+	std::unordered_map<std::string, item_info_t> items;
+	json_reader_t								 json { text };
+
+	json.object([&](const std::string &game_name) {
+		if (game_name != game)
+		{
+			json.skip_value();
+			return;
+		}
+
+		json.object([&](const std::string &) {
+			json.object([&](const std::string &classname) {
+				item_info_t info;
+
+				json.object([&](const std::string &field) {
+					if (field == "name")
+						info.name = json.string();
+					else if (field == "type")
+						info.type = json.string();
+					else
+						json.skip_value();
+				});
+
+				// first category to list a classname wins
+				items.emplace(classname, std::move(info));
+			});
+		});
+	});
+
+	return items;
+}
+
+/*
+============================================================================
+
+					CSV OUTPUT
+
+============================================================================
+*/
+
+struct options_t
+{
+	bool	 simple_names = true;
+	bool	 map_name_comment = true;
+	fs::path out_dir = "csv";
+};
+
+static bool is_item_classname(std::string_view classname)
+{
+	for (std::string_view prefix : { "item_", "weapon_", "ammo_", "holdable_" })
+		if (classname.substr(0, prefix.size()) == prefix)
+			return true;
+
+	return false;
+}
+
+// matches Python's csv module: quote only when needed, "" inside quotes
+static void csv_field(std::string &out, std::string_view value)
+{
+	if (value.find_first_of(",\"\r\n") == std::string_view::npos)
+	{
+		out += value;
+		return;
+	}
+
+	out += '\"';
+	for (char c : value)
+	{
+		if (c == '\"')
+			out += '\"';
+		out += c;
+	}
+	out += '\"';
+}
+
+static std::string to_snake_case(std::string_view name)
+{
+	std::string out(name);
+
+	for (char &c : out)
+		c = isalnum((unsigned char) c) || c == '_' ? (char) tolower((unsigned char) c) : '_';
+
+	return out;
+}
+
+struct map_result_t
+{
+	std::string message;
+	size_t		num_items = 0;
+	fs::path	csv_path;
+	std::string error;
+};
+
+static void process_map(const map_source_t &source, const std::unordered_map<std::string, item_info_t> &item_map,
+	const options_t &options, map_result_t &result)
+{
+	const uint8_t		*data = source.file->data() + source.offset;
+	size_t				 size = source.length;
+	std::vector<uint8_t> inflated;
+
+	if (source.offset > source.file->size() || source.length > source.file->size() - source.offset)
+		throw std::runtime_error("map data out of range");
+
+	if (source.deflated)
+	{
+		inflated.reserve(source.uncompressed_length);
+		inflate::run(data, size, inflated);
+		data = inflated.data();
+		size = inflated.size();
+	}
+
+	std::vector<entity_t> entities = parse_entities(bsp_entity_lump(data, size));
+
+	// worldspawn is always first
+	std::string_view message = "Unknown";
+
+	for (const entity_t &ent : entities)
+	{
+		if (ent.get("classname") == "worldspawn")
+		{
+			std::string_view msg = ent.get("message");
+			if (!msg.empty())
+				message = msg;
+			break;
+		}
+	}
+
+	std::string csv;
+
+	if (options.map_name_comment)
+	{
+		csv += "# Map: ";
+		csv += message;
+		csv += '\n';
+	}
+
+	csv += "friendly_name,class_name,item_type,x,y,z\r\n";
+
+	for (const entity_t &ent : entities)
+	{
+		std::string_view classname = ent.get("classname");
+
+		if (!is_item_classname(classname))
+			continue;
+
+		auto		info = item_map.find(std::string(classname));
+		std::string_view name = info != item_map.end() ? std::string_view(info->second.name) : classname;
+		std::string_view type = info != item_map.end() ? std::string_view(info->second.type) : "unknown";
+
+		// origin is copied through exactly as written in the map
+		std::string_view xyz[3] = { "N/A", "N/A", "N/A" };
+		std::string_view origin = ent.get("origin");
+
+		if (!origin.empty())
+		{
+			entity_tokenizer_t parts { origin };
+			std::string_view   part;
+			size_t			   count = 0;
+
+			while (count < 3 && parts.next(part))
+				xyz[count++] = part;
+
+			if (count != 3 || parts.next(part))
+				throw std::runtime_error("bad origin \"" + std::string(origin) + "\" on " + std::string(classname));
+		}
+
+		csv_field(csv, name);
+		csv += ',';
+		csv_field(csv, classname);
+		csv += ',';
+		csv_field(csv, type);
+		for (std::string_view v : xyz)
+		{
+			csv += ',';
+			csv_field(csv, v);
+		}
+		csv += "\r\n";
+
+		result.num_items++;
+	}
+
+	std::string filename = source.map_name;
+	if (!options.simple_names)
+		filename += "_" + to_snake_case(message);
+	filename += ".csv";
+
+	result.message = std::string(message);
+	result.csv_path = options.out_dir / filename;
+
+	std::ofstream out(result.csv_path, std::ios::binary);
+	if (!out.write(csv.data(), csv.size()))
+		throw std::runtime_error("couldn't write " + result.csv_path.string());
+}
+
+/*
+============================================================================
+
+					MAIN
+
+============================================================================
+*/
+
+static void add_path(const fs::path &path, std::vector<map_source_t> &sources)
+{
+	std::string display = path.string();
+	std::string ext = path.extension().string();
+
+	bool is_bsp = ends_with_nocase(ext, ".bsp");
+	bool is_pak = ends_with_nocase(ext, ".pak");
+	bool is_pkz = ends_with_nocase(ext, ".pkz") || ends_with_nocase(ext, ".zip");
+
+	if (!is_bsp && !is_pak && !is_pkz)
+		return;
+
+	auto file = std::make_shared<mapped_file_t>();
+
+	if (!file->open(path))
+	{
+		fprintf(stderr, "Error opening %s\n", display.c_str());
+		return;
+	}
+
+	try
+	{
+		if (is_bsp)
+		{
+			map_source_t source;
+			source.file = file;
+			source.display = display;
+			source.map_name = path.stem().string();
+			source.length = file->size();
+			sources.push_back(std::move(source));
+		}
+		else if (is_pak)
+			pak_list_maps(file, display, sources);
+		else
+			zip_list_maps(file, display, sources);
+	}
+	catch (const std::exception &e)
+	{
+		fprintf(stderr, "Error reading %s: %s\n", display.c_str(), e.what());
+	}
+}
+
+// every map writes <out_dir>/<map>*.csv, so a map found in more than one
+// place is only processed from the last source that has it; later
+// archives and directories override earlier ones
+static void drop_overridden_sources(std::vector<map_source_t> &sources)
+{
+	std::unordered_map<std::string, size_t> last_source;
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		std::string key = sources[i].map_name;
+		for (char &c : key)
+			c = (char) tolower((unsigned char) c);
+		last_source[std::move(key)] = i;
+	}
+
+	if (last_source.size() == sources.size())
+		return;
+
+	std::vector<bool> keep(sources.size(), false);
+	for (const auto &entry : last_source)
+		keep[entry.second] = true;
+
+	size_t n = 0;
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		if (keep[i])
+			sources[n++] = std::move(sources[i]);
+		else
+			printf("%s: skipped, overridden by a later source\n", sources[i].display.c_str());
+	}
+
+	sources.resize(n);
+}
+
+static fs::path find_item_map(const char *argv0)
+{
+	fs::path local = "item_map.json";
+
+	if (fs::exists(local))
+		return local;
+
+	// fall back to next to the executable
+	std::error_code ec;
+	fs::path		beside = fs::absolute(argv0, ec).parent_path() / "item_map.json";
+	return ec ? local : beside;
+}
+
+static void print_usage()
+{
+	printf("Usage: bsp_to_csv [--full-names] [--no-comments] [-o dir] [-j threads] [paths...]\n");
+	printf("  paths: .bsp, .pak or .pkz files, or directories of them (default: maps)\n");
+	printf("  --full-names: Use full descriptive names (q2dm1_the_edge.csv) instead of simple names (q2dm1.csv)\n");
+	printf("  --no-comments: Don't include map name as comment in CSV files\n");
+	printf("  -o dir: Where to write CSV files (default: csv)\n");
+	printf("  -j threads: Worker threads (default: one per core)\n");
+	printf("  Default: Simple names with map name comments\n");
+	printf("  Note: Only processes Quake 2 BSP files\n");
+}
+
+int main(int argc, char **argv)
+{
+	options_t			  options;
+	std::vector<fs::path> paths;
+	unsigned			  num_threads = std::max(1u, std::thread::hardware_concurrency());
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string_view arg = argv[i];
+
+		if (arg == "--full-names")
+			options.simple_names = false;
+		else if (arg == "--no-comments")
+			options.map_name_comment = false;
+		else if (arg == "-o" && i + 1 < argc)
+			options.out_dir = argv[++i];
+		else if (arg == "-j" && i + 1 < argc)
+			num_threads = std::max(1, atoi(argv[++i]));
+		else if (arg == "--help" || arg == "-h")
+		{
+			print_usage();
+			return 0;
+		}
+		else
+			paths.emplace_back(argv[i]);
+	}
+
+	// double-clicked on Windows: keep the window up at the end
+	bool pause = argc == 1;
+#ifndef _WIN32
+	pause = false;
+#endif
+
+	auto finish = [pause](int code) {
+		if (pause)
+		{
+			printf("Press Enter to exit...");
+			getchar();
+		}
+		return code;
+	};
+
+	if (paths.empty())
+	{
+		if (!fs::is_directory("maps"))
+		{
+			printf("Error: maps folder not found!\n");
+			return finish(1);
+		}
+
+		paths.emplace_back("maps");
+	}
+
+	std::unordered_map<std::string, item_info_t> item_map;
+
+	try
+	{
+		item_map = load_item_map(find_item_map(argv[0]), "Q2");
+	}
+	catch (const std::exception &e)
+	{
+		printf("Error: %s\n", e.what());
+		return finish(1);
+	}
+
+	std::error_code ec;
+	fs::create_directories(options.out_dir, ec);
+
+	auto start_time = std::chrono::steady_clock::now();
+
+	std::vector<map_source_t> sources;
+
+	for (const fs::path &path : paths)
+	{
+		if (fs::is_directory(path))
+		{
+			std::vector<fs::path> entries;
+			for (const fs::directory_entry &entry : fs::directory_iterator(path, ec))
+				if (entry.is_regular_file())
+					entries.push_back(entry.path());
+
+			// deterministic order; later archives override earlier ones
+			std::sort(entries.begin(), entries.end());
+
+			for (const fs::path &entry : entries)
+				add_path(entry, sources);
+		}
+		else
+			add_path(path, sources);
+	}
+
+	if (sources.empty())
+	{
+		printf("No BSP files found\n");
+		return finish(1);
+	}
+
+	// two workers must never write the same csv
+	drop_overridden_sources(sources);
+
+	std::vector<map_result_t> results(sources.size());
+	std::atomic<size_t>		  next_source { 0 };
+	std::vector<std::thread>  workers;
+
+	auto worker = [&]() {
+		for (size_t i; (i = next_source++) < sources.size();)
+		{
+			try
+			{
+				process_map(sources[i], item_map, options, results[i]);
+			}
+			catch (const std::exception &e)
+			{
+				results[i].error = e.what();
+			}
+		}
+	};
+
+	num_threads = std::min<unsigned>(num_threads, (unsigned) sources.size());
+
+	for (unsigned i = 1; i < num_threads; i++)
+		workers.emplace_back(worker);
+	worker();
+
+	for (std::thread &t : workers)
+		t.join();
+
+	size_t num_failed = 0;
+
+	for (size_t i = 0; i < sources.size(); i++)
+	{
+		const map_result_t &result = results[i];
+
+		if (!result.error.empty())
+		{
+			printf("Error processing %s: %s\n", sources[i].display.c_str(), result.error.c_str());
+			num_failed++;
+			continue;
+		}
+
+		printf("%s: \"%s\", %zu items -> %s\n", sources[i].display.c_str(), result.message.c_str(), result.num_items,
+			result.csv_path.string().c_str());
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+	printf("\n%zu of %zu maps processed in %.2fs on %u threads. CSV files can be found in: %s\n", sources.size() - num_failed,
+		sources.size(), seconds, num_threads, options.out_dir.string().c_str());
+
+	return finish(num_failed ? 1 : 0);
+}
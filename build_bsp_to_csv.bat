@@ -0,0 +1,18 @@
+@echo off
+echo Building bsp_to_csv...
+
+REM Find Visual Studio Build Tools
+call "C:\Program Files (x86)\Microsoft Visual Studio\2022\BuildTools\VC\Auxiliary\Build\vcvarsall.bat" x64
+
+REM Build the tool; no dependencies beyond the standard library
+cl /nologo /std:c++17 /O2 /EHsc /MT /W3 bsp_to_csv.cpp /Fe:bsp_to_csv.exe
+
+if %ERRORLEVEL% EQU 0 (
+    echo.
+    echo Build successful!
+    echo Tool created: bsp_to_csv.exe
+    echo.
+) else (
+    echo.
+    echo Build failed. Check the output above for errors.
+)
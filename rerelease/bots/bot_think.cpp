@@ -10,7 +10,7 @@ Bot_BeginFrame
 ================
 */
 void Bot_BeginFrame( edict_t * bot ) {
-
+	MapTrainer_RivalBotThink( bot );
 }
 
 /*
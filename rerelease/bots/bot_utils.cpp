@@ -7,6 +7,28 @@
 
 constexpr int Team_Coop_Monster = 0;
 
+/*
+================
+Bot_StatePublishingActive
+
+Nothing reads sv state unless a bot is playing, or one of the
+bot debug tools is running; skip publishing entirely otherwise.
+================
+*/
+bool Bot_StatePublishingActive() {
+	if ( bot_debug_follow_actor->integer || bot_debug_move_to_point->integer ) {
+		return true;
+	}
+
+	for ( auto player : active_players() ) {
+		if ( player->svflags & SVF_BOT ) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 /*
 ================
 Player_UpdateState
@@ -237,14 +259,13 @@ void Item_UpdateState( edict_t * item ) {
 	if ( item->solid == SOLID_NOT ) {
 		item->sv.ent_flags |= SVFL_IS_HIDDEN;
 
-		if ( item->nextthink.milliseconds() > 0 ) {
-			if ( ( item->svflags & SVF_RESPAWNING ) != 0 ) {
-				const gtime_t pendingRespawnTime = ( item->nextthink - level.time );
-				item->sv.respawntime = static_cast<int32_t>( pendingRespawnTime.milliseconds() );
-			} else {
-				// item will respawn at some unknown time in the future...
-				item->sv.respawntime = Item_UnknownRespawnTime;
-			}
+		// SetRespawn/DoRespawn keep item_respawn_time up to date
+		if ( ( item->svflags & SVF_RESPAWNING ) != 0 && item->item_respawn_time ) {
+			const gtime_t pendingRespawnTime = ( item->item_respawn_time - level.time );
+			item->sv.respawntime = static_cast<int32_t>( pendingRespawnTime.milliseconds() );
+		} else if ( item->nextthink.milliseconds() > 0 ) {
+			// item will respawn at some unknown time in the future...
+			item->sv.respawntime = Item_UnknownRespawnTime;
 		}
 	}
 
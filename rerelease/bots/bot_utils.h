@@ -3,6 +3,7 @@
 
 #pragma once
 
+bool Bot_StatePublishingActive();
 void Entity_UpdateState( edict_t * edict );
 const edict_t * FindLocalPlayer();
 const edict_t * FindFirstBot();
@@ -388,12 +388,8 @@ edict_t *SelectCTFSpawnPoint(edict_t *ent, bool force_spawn)
 	}
 
 	static std::vector<edict_t *> spawn_points;
-	edict_t *spot = nullptr;
 
-	spawn_points.clear();
-
-	while ((spot = G_FindByString<&edict_t::classname>(spot, cname)) != nullptr)
-		spawn_points.push_back(spot);
+	spawn_points = G_SpawnPointsOfClass(cname);
 
 	if (!spawn_points.size())
 	{
@@ -943,12 +939,61 @@ void CTFID_f(edict_t *ent)
 	}
 }
 
+/*
+=================
+CTF ID INDEX
+
+Candidates for the ID view are gathered once a frame for every viewer:
+each in-use solid client with its position and team. Viewers cull that
+list by their view cone before any trace.
+=================
+*/
+
+constexpr float CTF_ID_CONE = 0.90f; // cos of the ID view half-angle
+
+struct ctf_id_candidate_t
+{
+	edict_t	 *ent;
+	vec3_t	  origin;
+	ctfteam_t team;
+};
+
+static struct
+{
+	gtime_t							time = -1_ms;
+	std::vector<ctf_id_candidate_t> candidates;
+} ctf_id_index;
+
+// level.time restarts with the level, so the index has to be
+// dropped with it or a new level could reuse an old frame's list
+void CTFIDIndex_Clear()
+{
+	ctf_id_index.time = -1_ms;
+	ctf_id_index.candidates.clear();
+}
+
+static void CTFIDIndex_Update()
+{
+	if (ctf_id_index.time == level.time)
+		return;
+
+	ctf_id_index.time = level.time;
+	ctf_id_index.candidates.clear();
+
+	for (auto who : active_players())
+	{
+		if (who->solid == SOLID_NOT)
+			continue;
+
+		ctf_id_index.candidates.push_back({ who, who->s.origin, who->client->resp.ctf_team });
+	}
+}
+
 static void CTFSetIDView(edict_t *ent)
 {
 	vec3_t	 forward, dir;
 	trace_t	 tr;
-	edict_t *who, *best;
-	float	 bd = 0, d;
+	edict_t *best;
 
 	// only check every few frames
 	if (level.time - ent->client->resp.lastidtime < 250_ms)
@@ -972,28 +1017,48 @@ static void CTFSetIDView(edict_t *ent)
 		return;
 	}
 
+	CTFIDIndex_Update();
+
 	AngleVectors(ent->client->v_angle, forward, nullptr, nullptr);
-	best = nullptr;
-	for (uint32_t i = 1; i <= game.maxclients; i++)
+
+	// anything outside the cone can never be picked, so cull
+	// those before tracing; then the best visible one is simply
+	// the first visible one in order of how centered it is
+	struct
 	{
-		who = g_edicts + i;
-		if (!who->inuse || who->solid == SOLID_NOT)
-			continue;
-		dir = who->s.origin - ent->s.origin;
-		dir.normalize();
-		d = forward.dot(dir);
+		edict_t *ent;
+		float	 d;
+	} in_cone[MAX_CLIENTS];
+	size_t num_in_cone = 0;
 
+	for (const ctf_id_candidate_t &who : ctf_id_index.candidates)
+	{
 		// we have teammate indicators that are better for this
-		if (ent->client->resp.ctf_team == who->client->resp.ctf_team)
+		if (ent->client->resp.ctf_team == who.team)
 			continue;
 
-		if (d > bd && loc_CanSee(ent, who))
+		dir = who.origin - ent->s.origin;
+		dir.normalize();
+		float d = forward.dot(dir);
+
+		if (d > CTF_ID_CONE)
+			in_cone[num_in_cone++] = { who.ent, d };
+	}
+
+	std::sort(in_cone, in_cone + num_in_cone, [](const auto &a, const auto &b) { return a.d > b.d; });
+
+	best = nullptr;
+
+	for (size_t i = 0; i < num_in_cone; i++)
+	{
+		if (loc_CanSee(ent, in_cone[i].ent))
 		{
-			bd = d;
-			best = who;
+			best = in_cone[i].ent;
+			break;
 		}
 	}
-	if (bd > 0.90f)
+
+	if (best)
 	{
 		ent->client->ps.stats[STAT_CTF_ID_VIEW] = (best - g_edicts);
 		if (best->client->resp.ctf_team == CTF_TEAM1)
@@ -2,6 +2,48 @@
 // Licensed under the GNU General Public License 2.0.
 #include "../g_local.h"
 
+// each client has one menu slot that is reused for every menu they open,
+// along with the layout last sent for it. rows are only re-rendered when
+// their entry changes, and the layout is only re-sent when it differs.
+constexpr size_t MAX_PMENU_ROW = 224;
+constexpr size_t MAX_PMENU_LAYOUT = 32 + MAX_PMENU_ENTRIES * MAX_PMENU_ROW;
+constexpr const char *PMENU_LAYOUT_HEADER = "xv 32 yv 8 picn inventory ";
+
+struct pmenu_row_t
+{
+	// what the row was last rendered from
+	char text[sizeof(pmenu_t::text)];
+	char text_arg1[sizeof(pmenu_t::text_arg1)];
+	int	 align;
+	bool selected;
+
+	char   rendered[MAX_PMENU_ROW];
+	size_t length;
+};
+
+struct pmenu_slot_t
+{
+	pmenuhnd_t	hnd;
+	pmenu_t		entries[MAX_PMENU_ENTRIES];
+	pmenu_row_t rows[MAX_PMENU_ENTRIES];
+	bool		rows_valid;
+
+	char   layout[MAX_PMENU_LAYOUT];
+	size_t row_end[MAX_PMENU_ENTRIES]; // offset in layout just past each row
+	bool   layout_valid;
+	bool   layout_sent;
+};
+
+static std::vector<pmenu_slot_t> pmenu_slots;
+
+static pmenu_slot_t &PMenu_GetSlot(edict_t *ent)
+{
+	if (pmenu_slots.size() < game.maxclients)
+		pmenu_slots.resize(game.maxclients);
+
+	return pmenu_slots[ent - g_edicts - 1];
+}
+
 // Note that the pmenu entries are duplicated
 // this is so that a static set of pmenu entries can be used
 // for multiple clients and changed without interference
@@ -21,11 +63,19 @@ pmenuhnd_t *PMenu_Open(edict_t *ent, const pmenu_t *entries, int cur, int num, v
 		PMenu_Close(ent);
 	}
 
-	hnd = (pmenuhnd_t *) gi.TagMalloc(sizeof(*hnd), TAG_LEVEL);
+	if (num > (int) MAX_PMENU_ENTRIES)
+	{
+		gi.Com_PrintFmt("warning, menu has {} entries, only {} shown\n", num, MAX_PMENU_ENTRIES);
+		num = MAX_PMENU_ENTRIES;
+	}
+
+	pmenu_slot_t &slot = PMenu_GetSlot(ent);
+
+	hnd = &slot.hnd;
 	hnd->UpdateFunc = UpdateFunc;
 
 	hnd->arg = arg;
-	hnd->entries = (pmenu_t *) gi.TagMalloc(sizeof(pmenu_t) * num, TAG_LEVEL);
+	hnd->entries = slot.entries;
 	memcpy(hnd->entries, entries, sizeof(pmenu_t) * num);
 	// duplicate the strings since they may be from static memory
 	for (i = 0; i < num; i++)
@@ -33,6 +83,11 @@ pmenuhnd_t *PMenu_Open(edict_t *ent, const pmenu_t *entries, int cur, int num, v
 
 	hnd->num = num;
 
+	// new menu, so nothing cached is any good
+	slot.rows_valid = false;
+	slot.layout_valid = false;
+	slot.layout_sent = false;
+
 	if (cur < 0 || !entries[cur].SelectFunc)
 	{
 		for (i = 0, p = entries; i < num; i++, p++)
@@ -54,8 +109,8 @@ pmenuhnd_t *PMenu_Open(edict_t *ent, const pmenu_t *entries, int cur, int num, v
 	if (UpdateFunc)
 		UpdateFunc(ent);
 
-	PMenu_Do_Update(ent);
-	gi.unicast(ent, true);
+	if (PMenu_Do_Update(ent))
+		gi.unicast(ent, true);
 
 	return hnd;
 }
@@ -68,10 +123,11 @@ void PMenu_Close(edict_t *ent)
 		return;
 
 	hnd = ent->client->menu;
-	gi.TagFree(hnd->entries);
 	if (hnd->arg)
 		gi.TagFree(hnd->arg);
-	gi.TagFree(hnd);
+	hnd->arg = nullptr;
+	hnd->entries = nullptr;
+	hnd->num = 0;
 	ent->client->menu = nullptr;
 	ent->client->showscores = false;
 }
@@ -84,21 +140,56 @@ void PMenu_UpdateEntry(pmenu_t *entry, const char *text, int align, SelectFunc_t
 	entry->SelectFunc = SelectFunc;
 }
 
-#include "../g_statusbar.h"
+// render one row of the layout; empty rows render to nothing
+static void PMenu_RenderRow(pmenu_row_t &row, int i)
+{
+	row.length = 0;
+
+	if (!*row.text)
+		return; // blank line
+
+	const char *t = row.text;
+	bool		alt = false;
+
+	if (*t == '*')
+	{
+		alt = true;
+		t++;
+	}
+
+	int			x = 64;
+	const char *loc_func = "loc_string";
 
-void PMenu_Do_Update(edict_t *ent)
+	if (row.align == PMENU_ALIGN_CENTER)
+	{
+		x = 0;
+		loc_func = "loc_cstring";
+	}
+	else if (row.align == PMENU_ALIGN_RIGHT)
+	{
+		x = 260;
+		loc_func = "loc_rstring";
+	}
+
+	auto result = fmt::format_to_n(row.rendered, sizeof(row.rendered) - 1, FMT_STRING("yv {} xv {} {}{} 1 \"{}\" \"{}\" {}"),
+		32 + i * 8, x, loc_func, (row.selected || alt) ? "2" : "", t, row.text_arg1,
+		row.selected ? "xv 56 string2 \">\" " : "");
+
+	row.length = min(result.size, sizeof(row.rendered) - 1);
+	row.rendered[row.length] = '\0';
+}
+
+// returns true if a new layout was written and needs to be sent
+bool PMenu_Do_Update(edict_t *ent, bool force)
 {
 	int			i;
 	pmenu_t	*p;
-	int			x;
 	pmenuhnd_t *hnd;
-	const char *t;
-	bool		alt = false;
 
 	if (!ent->client->menu)
 	{
 		gi.Com_Print("warning:  ent has no menu\n");
-		return;
+		return false;
 	}
 
 	hnd = ent->client->menu;
@@ -106,60 +197,62 @@ void PMenu_Do_Update(edict_t *ent)
 	if (hnd->UpdateFunc)
 		hnd->UpdateFunc(ent);
 
-	statusbar_t sb;
-
-	sb.xv(32).yv(8).picn("inventory");
+	pmenu_slot_t &slot = PMenu_GetSlot(ent);
+	int first_changed = hnd->num;
 
+	// re-render only the rows whose entry changed
 	for (i = 0, p = hnd->entries; i < hnd->num; i++, p++)
 	{
-		if (!*(p->text))
-			continue; // blank line
+		pmenu_row_t &row = slot.rows[i];
+		bool selected = hnd->cur == i;
 
-		t = p->text;
+		if (slot.rows_valid && row.align == p->align && row.selected == selected &&
+			!strcmp(row.text, p->text) && !strcmp(row.text_arg1, p->text_arg1))
+			continue;
 
-		if (*t == '*')
-		{
-			alt = true;
-			t++;
-		}
+		Q_strlcpy(row.text, p->text, sizeof(row.text));
+		Q_strlcpy(row.text_arg1, p->text_arg1, sizeof(row.text_arg1));
+		row.align = p->align;
+		row.selected = selected;
+		PMenu_RenderRow(row, i);
 
-		sb.yv(32 + i * 8);
-
-		const char *loc_func = "loc_string";
-
-		if (p->align == PMENU_ALIGN_CENTER)
-		{
-			x = 0;
-			loc_func = "loc_cstring";
-		}
-		else if (p->align == PMENU_ALIGN_RIGHT)
-		{
-			x = 260;
-			loc_func = "loc_rstring";
-		}
-		else
-			x = 64;
+		first_changed = min(first_changed, i);
+	}
 
-		sb.xv(x);
+	slot.rows_valid = true;
 
-		sb.sb << loc_func;
+	if (!slot.layout_valid)
+		first_changed = 0;
 
-		if (hnd->cur == i || alt)
-			sb.sb << '2';
+	if (first_changed < hnd->num || !slot.layout_valid)
+	{
+		// everything before the first changed row is kept as-is
+		size_t length = first_changed ? slot.row_end[first_changed - 1] : strlen(PMENU_LAYOUT_HEADER);
 
-		sb.sb << " 1 \"" << t << "\" \"" << p->text_arg1 << "\" ";
+		if (!first_changed)
+			memcpy(slot.layout, PMENU_LAYOUT_HEADER, length);
 
-		if (hnd->cur == i)
+		for (i = first_changed; i < hnd->num; i++)
 		{
-			sb.xv(56);
-			sb.string2("\">\"");
+			const pmenu_row_t &row = slot.rows[i];
+
+			memcpy(slot.layout + length, row.rendered, row.length);
+			length += row.length;
+			slot.row_end[i] = length;
 		}
 
-		alt = false;
+		slot.layout[length] = '\0';
+		slot.layout_valid = true;
+		slot.layout_sent = false;
 	}
 
+	if (slot.layout_sent && !force)
+		return false;
+
 	gi.WriteByte(svc_layout);
-	gi.WriteString(sb.sb.str().c_str());
+	gi.WriteString(slot.layout);
+	slot.layout_sent = true;
+	return true;
 }
 
 void PMenu_Update(edict_t *ent)
@@ -173,8 +266,8 @@ void PMenu_Update(edict_t *ent)
 	if (level.time - ent->client->menutime >= 1_sec)
 	{
 		// been a second or more since last update, update now
-		PMenu_Do_Update(ent);
-		gi.unicast(ent, true);
+		if (PMenu_Do_Update(ent))
+			gi.unicast(ent, true);
 		ent->client->menutime = level.time + 1_sec;
 		ent->client->menudirty = false;
 	}
@@ -10,6 +10,8 @@ enum
 
 struct pmenu_t;
 
+constexpr size_t MAX_PMENU_ENTRIES = 18;
+
 using UpdateFunc_t = void (*)(edict_t *ent);
 
 struct pmenuhnd_t
@@ -34,7 +36,7 @@ struct pmenu_t
 pmenuhnd_t *PMenu_Open(edict_t *ent, const pmenu_t *entries, int cur, int num, void *arg, UpdateFunc_t UpdateFunc);
 void		PMenu_Close(edict_t *ent);
 void		PMenu_UpdateEntry(pmenu_t *entry, const char *text, int align, SelectFunc_t SelectFunc);
-void		PMenu_Do_Update(edict_t *ent);
+bool		PMenu_Do_Update(edict_t *ent, bool force = false);
 void		PMenu_Update(edict_t *ent);
 void		PMenu_Next(edict_t *ent);
 void		PMenu_Prev(edict_t *ent);
@@ -120,12 +120,7 @@ void SpawnDamage(int type, const vec3_t &origin, const vec3_t &normal, int damag
 {
 	if (damage > 255)
 		damage = 255;
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(type);
-	//	gi.WriteByte (damage);
-	gi.WritePosition(origin);
-	gi.WriteDir(normal);
-	gi.multicast(origin, MULTICAST_PVS, false);
+	G_TempEntity_Impact((temp_event_t) type, origin, normal);
 }
 
 /*
@@ -538,6 +533,8 @@ void T_Damage(edict_t *targ, edict_t *inflictor, edict_t *attacker, const vec3_t
 	if (!targ->takedamage)
 		return;
 
+	SV_WakeEntity(targ);
+
 	if (g_instagib->integer && attacker->client && targ->client)
 	{
 		// [Kex] always kill no matter what on instagib
@@ -125,6 +125,8 @@ gitem_t *FindItem(const char *pickup_name)
 
 THINK(DoRespawn) (edict_t *ent) -> void
 {
+	ent->item_respawn_time = 0_ms;
+
 	if (ent->team)
 	{
 		edict_t *master;
@@ -195,6 +197,9 @@ void SetRespawn(edict_t *ent, gtime_t delay, bool hide_self)
 		ent->svflags |= ( SVF_NOCLIENT | SVF_RESPAWNING );
 		ent->solid = SOLID_NOT;
 		gi.linkentity(ent);
+
+		// published to bots as the pending respawn time
+		ent->item_respawn_time = level.time + delay;
 	}
 
 	ent->nextthink = level.time + delay;
@@ -974,112 +979,25 @@ TOUCH(Touch_Item) (edict_t *ent, edict_t *other, const trace_t &tr, bool other_t
 		if (level.map_trainer.training_enabled)
 			MapTrainer_OnItemPickup(ent, other);
 		
+		// Map Trainer: remember contested pickups for rival bots to replay
+		MapTrainer_RecordRivalPickup(ent, other);
+		
 		// Map Trainer: Item Timing Trainer - start timer for armor, weapon, and powerup pickups
 		if (level.map_trainer.timing_enabled && ent->item && ent->item->classname)
 		{
-			const char *classname = ent->item->classname;
-			const char *item_name = nullptr;
-			gtime_t respawn_time = 20_sec; // Default respawn time
-			
-			// Check for armor items (20 second respawn)
-			if (Q_strcasecmp(classname, "item_armor_jacket") == 0)
-			{
-				item_name = "Green Armor";
-				respawn_time = 20_sec;
-			}
-			else if (Q_strcasecmp(classname, "item_armor_combat") == 0)
-			{
-				item_name = "Yellow Armor";
-				respawn_time = 20_sec;
-			}
-			else if (Q_strcasecmp(classname, "item_armor_body") == 0)
-			{
-				item_name = "Red Armor";
-				respawn_time = 20_sec;
-			}
-			// Check for power armor items (20 second respawn)
-			else if (Q_strcasecmp(classname, "item_power_screen") == 0)
-			{
-				item_name = "Power Screen";
-				respawn_time = 20_sec;
-			}
-			else if (Q_strcasecmp(classname, "item_power_shield") == 0)
-			{
-				item_name = "Power Shield";
-				respawn_time = 20_sec;
-			}
-			// Check for major powerups (300 second respawn = 5 minutes)
-			else if (Q_strcasecmp(classname, "item_invulnerability") == 0)
-			{
-				item_name = "Invulnerability";
-				respawn_time = 300_sec;
-			}
-			else if (Q_strcasecmp(classname, "item_invisibility") == 0)
-			{
-				item_name = "Invisibility";
-				respawn_time = 300_sec;
-			}
-			// Check for lesser powerups (60 second respawn = 1 minute)
-			else if (Q_strcasecmp(classname, "item_quad") == 0)
-			{
-				item_name = "Quad Damage";
-				respawn_time = 60_sec;
-			}
-			else if (Q_strcasecmp(classname, "item_double") == 0)
-			{
-				item_name = "Double Damage";
-				respawn_time = 60_sec;
-			}
-			else if (Q_strcasecmp(classname, "item_quadfire") == 0)
-			{
-				item_name = "DualFire Damage";
-				respawn_time = 60_sec;
-			}
-			// Check for megahealth (special 25 second timing - 5 sec decay + 20 sec respawn)
-			else if (Q_strcasecmp(classname, "item_health_mega") == 0)
-			{
-				item_name = "Megahealth";
-				respawn_time = 25_sec; // Total time estimate (will be dynamic based on player health)
-			}
-			// Check for weapon items (30 second respawn - typical weapon respawn time)
-			else if (ent->item->pickup == Pickup_Weapon)
-			{
-				// Get weapon respawn time from cvar (default 30 seconds)
-				respawn_time = gtime_t::from_sec(g_weapon_respawn_time ? g_weapon_respawn_time->integer : 30);
-				
-				// Set friendly names for common weapons
-				if (Q_strcasecmp(classname, "weapon_shotgun") == 0)
-					item_name = "Shotgun";
-				else if (Q_strcasecmp(classname, "weapon_supershotgun") == 0)
-					item_name = "Super Shotgun";
-				else if (Q_strcasecmp(classname, "weapon_machinegun") == 0)
-					item_name = "Machinegun";
-				else if (Q_strcasecmp(classname, "weapon_chaingun") == 0)
-					item_name = "Chaingun";
-				else if (Q_strcasecmp(classname, "weapon_grenadelauncher") == 0)
-					item_name = "Grenade Launcher";
-				else if (Q_strcasecmp(classname, "weapon_rocketlauncher") == 0)
-					item_name = "Rocket Launcher";
-				else if (Q_strcasecmp(classname, "weapon_hyperblaster") == 0)
-					item_name = "Hyperblaster";
-				else if (Q_strcasecmp(classname, "weapon_railgun") == 0)
-					item_name = "Railgun";
-				else if (Q_strcasecmp(classname, "weapon_bfg10k") == 0)
-					item_name = "BFG10K";
-				else
-					item_name = "Weapon"; // Generic fallback
-			}
+			const char *item_name;
+			gtime_t respawn_time;
 				
-					if (item_name)
+			if (MapTrainer_GetTimingInfo(ent->item, item_name, respawn_time))
 		{
 			// Create or update timing entry for this item
 			map_trainer_t::timing_entry_t* timing_entry = MapTrainer_CreateOrUpdateTimingEntry(
-				classname, item_name, ent->s.origin, level.time, respawn_time);
+				ent->item->id, item_name, ent->s.origin, level.time, respawn_time);
 			
 			if (timing_entry)
 			{
 				// Special handling for megahealth
-				if (Q_strcasecmp(classname, "item_health_mega") == 0)
+				if (ent->item->id == IT_HEALTH_MEGA)
 				{
 					timing_entry->is_megahealth = true;
 					timing_entry->megahealth_player = other;
@@ -1113,7 +1031,7 @@ TOUCH(Touch_Item) (edict_t *ent, edict_t *other, const trace_t &tr, bool other_t
 			}
 
 			// Show pickup message
-			if (Q_strcasecmp(classname, "item_health_mega") == 0)
+			if (ent->item->id == IT_HEALTH_MEGA)
 			{
 				gi.LocClient_Print(other, PRINT_HIGH, "Megahealth - 20s timer after health < 100");
 			}
@@ -4092,6 +4010,137 @@ model="models/items/mega_h/tris.md2"
 
 // ==================== MAP TRAINER SYSTEM ====================
 
+// Everything the trainer needs to know about an item type is looked up by
+// item_id_t, so pickups and target checks never compare classnames.
+
+// combined health packs group under this virtual id, one past the real ones
+constexpr item_id_t MT_ITEM_HEALTH_COMBINED = IT_TOTAL;
+constexpr size_t	MT_ITEM_COUNT = IT_TOTAL + 1;
+
+enum map_trainer_category_t : uint8_t
+{
+	MT_CATEGORY_OTHER, // never filtered
+	MT_CATEGORY_WEAPON,
+	MT_CATEGORY_AMMO,
+	MT_CATEGORY_HEALTH,
+	MT_CATEGORY_ARMOR,
+	MT_CATEGORY_POWERUP
+};
+
+struct map_trainer_timing_info_t
+{
+	const char *name;		  // nullptr if the timing trainer ignores it
+	gtime_t		respawn_time; // weapons use g_weapon_respawn_time instead
+};
+
+static constexpr std::array<map_trainer_timing_info_t, IT_TOTAL> MapTrainer_BuildTimingTable()
+{
+	std::array<map_trainer_timing_info_t, IT_TOTAL> t {};
+
+	// armor
+	t[IT_ARMOR_JACKET] = { "Green Armor", 20_sec };
+	t[IT_ARMOR_COMBAT] = { "Yellow Armor", 20_sec };
+	t[IT_ARMOR_BODY] = { "Red Armor", 20_sec };
+	t[IT_ITEM_POWER_SCREEN] = { "Power Screen", 20_sec };
+	t[IT_ITEM_POWER_SHIELD] = { "Power Shield", 20_sec };
+
+	// major powerups
+	t[IT_ITEM_INVULNERABILITY] = { "Invulnerability", 300_sec };
+	t[IT_ITEM_INVISIBILITY] = { "Invisibility", 300_sec };
+
+	// lesser powerups
+	t[IT_ITEM_QUAD] = { "Quad Damage", 60_sec };
+	t[IT_ITEM_DOUBLE] = { "Double Damage", 60_sec };
+	t[IT_ITEM_QUADFIRE] = { "DualFire Damage", 60_sec };
+
+	// 5 sec decay estimate + 20 sec respawn; the real timer starts
+	// once the player's health drops to 100
+	t[IT_HEALTH_MEGA] = { "Megahealth", 25_sec };
+
+	// weapons; anything else picked up as a weapon is just "Weapon"
+	t[IT_WEAPON_SHOTGUN] = { "Shotgun" };
+	t[IT_WEAPON_SSHOTGUN] = { "Super Shotgun" };
+	t[IT_WEAPON_MACHINEGUN] = { "Machinegun" };
+	t[IT_WEAPON_CHAINGUN] = { "Chaingun" };
+	t[IT_WEAPON_GLAUNCHER] = { "Grenade Launcher" };
+	t[IT_WEAPON_RLAUNCHER] = { "Rocket Launcher" };
+	t[IT_WEAPON_HYPERBLASTER] = { "Hyperblaster" };
+	t[IT_WEAPON_RAILGUN] = { "Railgun" };
+	t[IT_WEAPON_BFG] = { "BFG10K" };
+
+	return t;
+}
+
+static constexpr std::array<map_trainer_timing_info_t, IT_TOTAL> mt_timing_info = MapTrainer_BuildTimingTable();
+
+// categories follow the classname conventions, so they are
+// derived from itemlist once rather than kept by hand
+static map_trainer_category_t MapTrainer_CategoryFromClassName(const char *class_name)
+{
+	if (!class_name)
+		return MT_CATEGORY_OTHER;
+
+	// Quad damage is a weapon powerup but treat as weapon
+	if (strstr(class_name, "weapon_") == class_name || Q_strcasecmp(class_name, "item_quad") == 0)
+		return MT_CATEGORY_WEAPON;
+	if (strstr(class_name, "ammo_") == class_name)
+		return MT_CATEGORY_AMMO;
+	if (strstr(class_name, "item_health") == class_name)
+		return MT_CATEGORY_HEALTH;
+	if (strstr(class_name, "item_armor") == class_name ||
+		Q_strcasecmp(class_name, "item_power_screen") == 0 ||
+		Q_strcasecmp(class_name, "item_power_shield") == 0)
+		return MT_CATEGORY_ARMOR;
+	// Powerups (everything else)
+	if (strstr(class_name, "item_") == class_name)
+		return MT_CATEGORY_POWERUP;
+
+	return MT_CATEGORY_OTHER;
+}
+
+static map_trainer_category_t MapTrainer_ItemCategory(item_id_t id)
+{
+	static const std::array<map_trainer_category_t, MT_ITEM_COUNT> categories = []() {
+		std::array<map_trainer_category_t, MT_ITEM_COUNT> c {};
+
+		for (size_t i = 0; i < IT_TOTAL; i++)
+			c[i] = MapTrainer_CategoryFromClassName(itemlist[i].classname);
+
+		c[MT_ITEM_HEALTH_COMBINED] = MT_CATEGORY_HEALTH;
+		return c;
+	}();
+
+	return categories[id];
+}
+
+/*
+=================
+MapTrainer_GetTimingInfo
+
+Fills in the timing trainer's name and respawn time for
+the given item. Returns false if the item isn't timed.
+=================
+*/
+bool MapTrainer_GetTimingInfo(const gitem_t *item, const char *&item_name, gtime_t &respawn_time)
+{
+	const map_trainer_timing_info_t &info = mt_timing_info[item->id];
+
+	if (item->pickup == Pickup_Weapon)
+	{
+		item_name = info.name ? info.name : "Weapon";
+		respawn_time = gtime_t::from_sec(g_weapon_respawn_time ? g_weapon_respawn_time->integer : 30);
+		return true;
+	}
+
+	item_name = info.name;
+	respawn_time = info.respawn_time;
+	return info.name != nullptr;
+}
+
+
+// Forward declaration for MapTrainer_Init
+static void MapTrainer_RemoveRivalBots();
+
 void MapTrainer_Init()
 {
 	// Force weapon stay off for training mode
@@ -4139,8 +4188,15 @@ void MapTrainer_Init()
 		level.map_trainer.timing_entries[i].respawn_time = 20_sec;
 		level.map_trainer.timing_entries[i].grace_period_end = 0_ms;
 		level.map_trainer.timing_entries[i].item_name = nullptr;
-		level.map_trainer.timing_entries[i].item_classname = nullptr;
+		level.map_trainer.timing_entries[i].item_id = IT_NULL;
 	}
+	
+	// Rival bots are off until enabled from the menu; nothing recorded yet,
+	// and any rivals left over from the last map go away
+	level.map_trainer.rival_enabled = false;
+	level.map_trainer.rival_history_count = 0;
+	level.map_trainer.rival_route_count = 0;
+	MapTrainer_RemoveRivalBots();
 }
 
 // Forward declaration for MapTrainer_FriendlyNameFromPickup
@@ -4170,7 +4226,7 @@ void MapTrainer_BuildItemList(const char *mapname)
 
 		// Only include actual items (entities with an item field)
 		// Only include items that are in the enabled categories
-		if (!MapTrainer_IsItemCategoryEnabled(ent->classname))
+		if (!MapTrainer_IsItemCategoryEnabled(ent->item->id))
 			continue;
 
 		// Get friendly name from the actual item definition that the game uses
@@ -4183,6 +4239,7 @@ void MapTrainer_BuildItemList(const char *mapname)
 		map_trainer_item_t item;
 		Q_strlcpy(item.friendly_name, friendly_name, sizeof(item.friendly_name));
 		Q_strlcpy(item.class_name, ent->classname, sizeof(item.class_name));
+		item.id = ent->item->id;
 		item.position = ent->s.origin;
 
 		temp_items.push_back(item);
@@ -4205,29 +4262,27 @@ void MapTrainer_BuildItemList(const char *mapname)
 	}
 }
 
-bool MapTrainer_IsCombinableHealthPack(const char *class_name)
+bool MapTrainer_IsCombinableHealthPack(item_id_t id)
 {
 	// These health packs can be combined when the option is enabled
 	// Mega health is NOT included in this list
-	return (Q_strcasecmp(class_name, "item_health_small") == 0 ||
-			Q_strcasecmp(class_name, "item_health") == 0 ||
-			Q_strcasecmp(class_name, "item_health_large") == 0);
+	return id == IT_HEALTH_SMALL || id == IT_HEALTH_MEDIUM || id == IT_HEALTH_LARGE;
 }
 
-const char* MapTrainer_GetNormalizedClassName(const char *class_name)
+item_id_t MapTrainer_GetNormalizedItem(item_id_t id)
 {
-	// If combine health packs is enabled, normalize health pack class names (combine them)
-	if (level.map_trainer.combine_health_packs && MapTrainer_IsCombinableHealthPack(class_name))
+	// If combine health packs is enabled, normalize health packs (combine them)
+	if (level.map_trainer.combine_health_packs && MapTrainer_IsCombinableHealthPack(id))
 	{
-		return "item_health_combined"; // Virtual class name for combined health packs
+		return MT_ITEM_HEALTH_COMBINED; // Virtual item for combined health packs
 	}
-	return class_name;
+	return id;
 }
 
-const char* MapTrainer_GetDisplayFriendlyName(const char *class_name, const char *original_friendly_name)
+const char* MapTrainer_GetDisplayFriendlyName(item_id_t id, const char *original_friendly_name)
 {
 	// If combine health packs is enabled, use generic name for combinable health packs
-	if (level.map_trainer.combine_health_packs && MapTrainer_IsCombinableHealthPack(class_name))
+	if (level.map_trainer.combine_health_packs && MapTrainer_IsCombinableHealthPack(id))
 	{
 		return "Health Pack"; // Generic display name for combined health packs
 	}
@@ -4236,134 +4291,117 @@ const char* MapTrainer_GetDisplayFriendlyName(const char *class_name, const char
 
 void MapTrainer_BuildUniqueItemsList()
 {
+	// unique items and every group's indices share one block;
+	// release the previous grouping before building a new one
+	if (level.map_trainer.unique_items)
+	{
+		gi.TagFree(level.map_trainer.unique_items);
+		level.map_trainer.unique_items = nullptr;
+	}
+	level.map_trainer.unique_item_count = 0;
+
 	if (!level.map_trainer.initialized || level.map_trainer.item_count == 0)
 		return;
 	
-	// Allocate memory for unique items (worst case: all items are unique)
-	level.map_trainer.unique_items = (map_trainer_unique_item_t*)gi.TagMalloc(
-		sizeof(map_trainer_unique_item_t) * level.map_trainer.item_count, TAG_LEVEL);
-	level.map_trainer.unique_item_count = 0;
-	
-	// Process each item to build unique list
-	for (size_t i = 0; i < static_cast<size_t>(level.map_trainer.item_count); i++)
+	// Counting pass: give each normalized item a group, in order of
+	// first appearance, and count how many instances land in each;
+	// there's at most one group per normalized item, so the scratch
+	// space fits on the stack
+	int32_t group_of_item[MT_ITEM_COUNT];
+	std::fill(std::begin(group_of_item), std::end(group_of_item), -1);
+
+	int32_t group_first[MT_ITEM_COUNT];
+	int32_t group_count[MT_ITEM_COUNT];
+	int32_t num_groups = 0;
+
+	for (int32_t i = 0; i < level.map_trainer.item_count; i++)
 	{
-		map_trainer_item_t *current_item = &level.map_trainer.items[i];
-		bool found_existing = false;
-		
-		// Get normalized class name (handles health pack combining)
-		const char *normalized_class_name = MapTrainer_GetNormalizedClassName(current_item->class_name);
-		
-		// Check if this normalized class_name already exists in unique list
-		for (size_t j = 0; j < static_cast<size_t>(level.map_trainer.unique_item_count); j++)
+		int32_t &group = group_of_item[MapTrainer_GetNormalizedItem(level.map_trainer.items[i].id)];
+
+		if (group == -1)
 		{
-			if (Q_strcasecmp(level.map_trainer.unique_items[j].class_name, normalized_class_name) == 0)
-			{
-				// Found existing unique item, add this instance to it
-				map_trainer_unique_item_t *unique_item = &level.map_trainer.unique_items[j];
-				
-				// Reallocate indices array to fit one more
-				int32_t *new_indices = (int32_t*)gi.TagMalloc(
-					sizeof(int32_t) * (unique_item->instance_count + 1), TAG_LEVEL);
-				
-				// Copy existing indices
-				if (unique_item->item_indices)
-				{
-					memcpy(new_indices, unique_item->item_indices, sizeof(int32_t) * unique_item->instance_count);
-					gi.TagFree(unique_item->item_indices);
-				}
-				
-				// Add new index
-				new_indices[unique_item->instance_count] = static_cast<int32_t>(i);
-				unique_item->item_indices = new_indices;
-				unique_item->instance_count++;
-				
-				found_existing = true;
-				break;
-			}
+			group = num_groups++;
+			group_first[group] = i;
+			group_count[group] = 0;
 		}
-		
-		if (!found_existing)
+
+		group_count[group]++;
+	}
+
+	// One allocation: the unique items, followed by all of their
+	// indices laid out back to back (each group's instance_count
+	// entries starting at its item_indices)
+	size_t header_size = sizeof(map_trainer_unique_item_t) * num_groups;
+	uint8_t *block = (uint8_t *) gi.TagMalloc(header_size + sizeof(int32_t) * level.map_trainer.item_count, TAG_LEVEL);
+
+	level.map_trainer.unique_items = (map_trainer_unique_item_t *) block;
+	level.map_trainer.unique_item_count = num_groups;
+
+	int32_t *indices = (int32_t *) (block + header_size);
+
+	for (int32_t g = 0; g < num_groups; g++)
+	{
+		map_trainer_unique_item_t *unique_item = &level.map_trainer.unique_items[g];
+		const map_trainer_item_t *first_item = &level.map_trainer.items[group_first[g]];
+
+		unique_item->id = MapTrainer_GetNormalizedItem(first_item->id);
+
+		// For combined health packs, use a generic friendly name
+		if (unique_item->id == MT_ITEM_HEALTH_COMBINED)
 		{
-			// Create new unique item entry
-			map_trainer_unique_item_t *unique_item = &level.map_trainer.unique_items[level.map_trainer.unique_item_count];
-			
-			strcpy(unique_item->class_name, normalized_class_name);
-			// For combined health packs, use a generic friendly name
-			if (level.map_trainer.combine_health_packs && MapTrainer_IsCombinableHealthPack(current_item->class_name))
-			{
-				strcpy(unique_item->friendly_name, "health pack");
-			}
-			else
-			{
-				strcpy(unique_item->friendly_name, current_item->friendly_name);
-			}
-			
-			// Allocate indices array with first instance
-			unique_item->item_indices = (int32_t*)gi.TagMalloc(sizeof(int32_t), TAG_LEVEL);
-			unique_item->item_indices[0] = static_cast<int32_t>(i);
-			unique_item->instance_count = 1;
-			
-			level.map_trainer.unique_item_count++;
+			strcpy(unique_item->class_name, "item_health_combined");
+			strcpy(unique_item->friendly_name, "health pack");
+		}
+		else
+		{
+			strcpy(unique_item->class_name, first_item->class_name);
+			strcpy(unique_item->friendly_name, first_item->friendly_name);
 		}
+
+		unique_item->item_indices = indices;
+		unique_item->instance_count = 0;
+		indices += group_count[g];
+	}
+
+	// Fill pass: drop each item into its group's slice
+	for (int32_t i = 0; i < level.map_trainer.item_count; i++)
+	{
+		map_trainer_unique_item_t *unique_item = &level.map_trainer.unique_items[group_of_item[MapTrainer_GetNormalizedItem(level.map_trainer.items[i].id)]];
+		unique_item->item_indices[unique_item->instance_count++] = i;
 	}
-	
-	// Debug output removed to reduce verbosity
 }
 
-// Determine what category an item belongs to based on its class name
-bool MapTrainer_IsItemCategoryEnabled(const char *class_name)
+// Determine whether an item's category is enabled
+bool MapTrainer_IsItemCategoryEnabled(item_id_t id)
 {
-	// Weapons
-	if (strstr(class_name, "weapon_") == class_name ||
-		Q_strcasecmp(class_name, "item_quad") == 0) // Quad damage is a weapon powerup but treat as weapon
+	switch (MapTrainer_ItemCategory(id))
 	{
+	case MT_CATEGORY_WEAPON:
 		return level.map_trainer.weapons_enabled;
-	}
-	
-	// Ammo
-	if (strstr(class_name, "ammo_") == class_name)
-	{
+	case MT_CATEGORY_AMMO:
 		return level.map_trainer.ammo_enabled;
-	}
-	
-	// Health items (including combined health pack virtual class)
-	if (strstr(class_name, "item_health") == class_name ||
-		Q_strcasecmp(class_name, "item_health_small") == 0 ||
-		Q_strcasecmp(class_name, "item_health_large") == 0 ||
-		Q_strcasecmp(class_name, "item_health_mega") == 0 ||
-		Q_strcasecmp(class_name, "item_health_combined") == 0)
-	{
+	case MT_CATEGORY_HEALTH:
 		return level.map_trainer.health_enabled;
-	}
-	
-	// Armor items
-	if (strstr(class_name, "item_armor") == class_name ||
-		Q_strcasecmp(class_name, "item_jacket_armor") == 0 ||
-		Q_strcasecmp(class_name, "item_combat_armor") == 0 ||
-		Q_strcasecmp(class_name, "item_body_armor") == 0 ||
-		Q_strcasecmp(class_name, "item_power_screen") == 0 ||
-		Q_strcasecmp(class_name, "item_power_shield") == 0)
-	{
+	case MT_CATEGORY_ARMOR:
 		return level.map_trainer.armor_enabled;
-	}
-	
-	// Powerups (everything else)
-	if (strstr(class_name, "item_") == class_name)
-	{
+	case MT_CATEGORY_POWERUP:
 		return level.map_trainer.powerups_enabled;
+	default:
+		// Default to enabled for unknown items
+		return true;
 	}
-	
-	// Default to enabled for unknown items
-	return true;
 }
 
 // Check if an item entity is available (not respawning)
-bool MapTrainer_IsItemAvailable(const char *class_name, const vec3_t &position)
+bool MapTrainer_IsItemAvailable(item_id_t id, const vec3_t &position)
 {
-	// Find all entities with matching classname and check if any are available
-	edict_t *ent = nullptr;
-	while ((ent = G_FindByString<&edict_t::classname>(ent, class_name)) != nullptr)
+	// Find all entities with matching item and check if any are available
+	for (uint32_t i = game.maxclients + 1; i < globals.num_edicts; i++)
 	{
+		edict_t *ent = &g_edicts[i];
+		if (!ent->inuse || !ent->item || ent->item->id != id)
+			continue;
+
 		vec3_t diff = ent->s.origin - position;
 		float distance = diff.length();
 		
@@ -4386,11 +4424,11 @@ void MapTrainer_PickNewTarget()
 	if (!level.map_trainer.initialized || level.map_trainer.unique_item_count == 0)
 		return;
 	
-	// Get the normalized class name of the previous target to avoid picking the same type
-	const char *previous_class_name = nullptr;
+	// Get the normalized item of the previous target to avoid picking the same type
+	item_id_t previous_id = IT_NULL;
 	if (level.map_trainer.previous_target_index >= 0)
 	{
-		previous_class_name = MapTrainer_GetNormalizedClassName(level.map_trainer.items[level.map_trainer.previous_target_index].class_name);
+		previous_id = MapTrainer_GetNormalizedItem(level.map_trainer.items[level.map_trainer.previous_target_index].id);
 	}
 	
 	// Build a list of available unique item types
@@ -4400,14 +4438,14 @@ void MapTrainer_PickNewTarget()
 		map_trainer_unique_item_t *unique_item = &level.map_trainer.unique_items[i];
 		
 		// Skip if this is the same type as previous (if we have more than one type)
-		if (level.map_trainer.unique_item_count > 1 && previous_class_name != nullptr &&
-			Q_strcasecmp(unique_item->class_name, previous_class_name) == 0)
+		if (level.map_trainer.unique_item_count > 1 && previous_id != IT_NULL &&
+			unique_item->id == previous_id)
 		{
 			continue;
 		}
 		
 		// Check if this item category is enabled
-		if (!MapTrainer_IsItemCategoryEnabled(unique_item->class_name))
+		if (!MapTrainer_IsItemCategoryEnabled(unique_item->id))
 		{
 			continue;
 		}
@@ -4419,7 +4457,7 @@ void MapTrainer_PickNewTarget()
 			int32_t item_index = unique_item->item_indices[j];
 			map_trainer_item_t *item = &level.map_trainer.items[item_index];
 			
-			if (MapTrainer_IsItemAvailable(item->class_name, item->position))
+			if (MapTrainer_IsItemAvailable(item->id, item->position))
 			{
 				has_available_instance = true;
 				break;
@@ -4450,7 +4488,7 @@ void MapTrainer_PickNewTarget()
 		int32_t item_index = unique_item->item_indices[j];
 		map_trainer_item_t *item = &level.map_trainer.items[item_index];
 		
-		if (MapTrainer_IsItemAvailable(item->class_name, item->position))
+		if (MapTrainer_IsItemAvailable(item->id, item->position))
 		{
 			available_instances.push_back(item_index);
 		}
@@ -4478,8 +4516,8 @@ void MapTrainer_PickNewTarget()
 		map_trainer_item_t *previous = &level.map_trainer.items[level.map_trainer.previous_target_index];
 		
 		// Get display-friendly names (handles health pack combining)
-		const char *previous_display_name = MapTrainer_GetDisplayFriendlyName(previous->class_name, previous->friendly_name);
-		const char *target_display_name = MapTrainer_GetDisplayFriendlyName(target->class_name, target->friendly_name);
+		const char *previous_display_name = MapTrainer_GetDisplayFriendlyName(previous->id, previous->friendly_name);
+		const char *target_display_name = MapTrainer_GetDisplayFriendlyName(target->id, target->friendly_name);
 		
 		// Send message to all players
 		for (uint32_t i = 0; i < game.maxclients; i++)
@@ -4501,19 +4539,15 @@ bool MapTrainer_IsTargetItem(edict_t *ent)
 	if (!level.map_trainer.initialized || level.map_trainer.current_target_index < 0)
 		return false;
 		
-	if (!ent->item || !ent->item->classname)
+	if (!ent->item)
 		return false;
 		
 	map_trainer_item_t *target = &level.map_trainer.items[level.map_trainer.current_target_index];
 	
-	// Get normalized class names for comparison (handles health pack combining)
-	const char *ent_normalized = MapTrainer_GetNormalizedClassName(ent->item->classname);
-	const char *target_normalized = MapTrainer_GetNormalizedClassName(target->class_name);
-	
-	// Check if normalized class names match
-	if (Q_strcasecmp(ent_normalized, target_normalized) == 0)
+	// Check if normalized items match (handles health pack combining)
+	if (MapTrainer_GetNormalizedItem(ent->item->id) == MapTrainer_GetNormalizedItem(target->id))
 	{
-		return true; // Accept any matching class name (including combined health packs)
+		return true; // Accept any matching item (including combined health packs)
 	}
 	
 	return false;
@@ -4524,7 +4558,7 @@ void MapTrainer_OnItemPickup(edict_t *item_ent, edict_t *player)
 	if (!level.map_trainer.initialized)
 		return;
 	
-	const char *item_name = item_ent->item ? item_ent->item->classname : "unknown";
+	item_id_t item_id = item_ent->item ? item_ent->item->id : IT_NULL;
 	
 	// If this is the first pickup, any item becomes the source
 	if (level.map_trainer.first_pickup)
@@ -4533,7 +4567,7 @@ void MapTrainer_OnItemPickup(edict_t *item_ent, edict_t *player)
 		int32_t source_index = -1;
 		for (int32_t i = 0; i < level.map_trainer.item_count; i++)
 		{
-			if (Q_strcasecmp(level.map_trainer.items[i].class_name, item_name) == 0)
+			if (level.map_trainer.items[i].id == item_id)
 			{
 				source_index = i;
 				break;
@@ -4578,6 +4612,227 @@ void MapTrainer_ShowWelcomeMessage(edict_t *player)
 	}
 }
 
+// ==================== RIVAL BOT SYSTEM ====================
+
+// Rival bots are bots the trainer adds when rivals are enabled, and they
+// run a fixed route around the armor and megahealth spawns, timed from a
+// human player's own pickups. The route is compiled once when rivals are
+// enabled; after that every rival shares one step index that advances at
+// most once a frame, and a bot is only given a new move order when the
+// step it's heading for changes.
+
+constexpr float MAP_TRAINER_RIVAL_SPEED = 300.0f; // rough running speed, for travel estimates
+constexpr int32_t MAP_TRAINER_RIVAL_BOTS = 1;
+
+static bool MapTrainer_IsContestedItem(const gitem_t *item)
+{
+	if (!item)
+		return false;
+
+	return item->id == IT_ARMOR_BODY || item->id == IT_ARMOR_COMBAT || item->id == IT_ARMOR_JACKET || item->id == IT_HEALTH_MEGA;
+}
+
+static gtime_t MapTrainer_RivalTravelTime(const vec3_t &from, const vec3_t &to)
+{
+	return gtime_t::from_sec((to - from).length() / MAP_TRAINER_RIVAL_SPEED);
+}
+
+void MapTrainer_RecordRivalPickup(edict_t *item_ent, edict_t *player)
+{
+	if (!player->client || (player->svflags & SVF_BOT))
+		return;
+	
+	if (!MapTrainer_IsContestedItem(item_ent->item) || item_ent->spawnflags.has(SPAWNFLAG_ITEM_DROPPED))
+		return;
+	
+	// Keep the first lap's worth; that's the route
+	if (level.map_trainer.rival_history_count >= level.map_trainer.MAX_RIVAL_STEPS)
+		return;
+	
+	if (!level.map_trainer.rival_history_count)
+		level.map_trainer.rival_history_start = level.time;
+	
+	map_trainer_t::rival_step_t &step = level.map_trainer.rival_history[level.map_trainer.rival_history_count++];
+	step.position = item_ent->s.origin;
+	step.time = level.time - level.map_trainer.rival_history_start;
+}
+
+// Compile the route rivals will run. Uses the recorded pickups if there
+// are enough of them, otherwise visits every armor and megahealth spawn
+// on the map in nearest-first order at running pace.
+static void MapTrainer_CompileRivalRoute()
+{
+	map_trainer_t &trainer = level.map_trainer;
+	
+	trainer.rival_route_count = 0;
+	
+	if (trainer.rival_history_count >= 2)
+	{
+		for (int32_t i = 0; i < trainer.rival_history_count; i++)
+			trainer.rival_route[i] = trainer.rival_history[i];
+		
+		trainer.rival_route_count = trainer.rival_history_count;
+	}
+	else
+	{
+		vec3_t spawns[map_trainer_t::MAX_RIVAL_STEPS];
+		int32_t num_spawns = 0;
+		
+		for (edict_t *ent = g_edicts + game.maxclients + 1; ent < g_edicts + globals.num_edicts && num_spawns < trainer.MAX_RIVAL_STEPS; ent++)
+		{
+			if (!ent->inuse || !MapTrainer_IsContestedItem(ent->item) || ent->spawnflags.has(SPAWNFLAG_ITEM_DROPPED))
+				continue;
+			
+			spawns[num_spawns++] = ent->s.origin;
+		}
+		
+		for (int32_t i = 0; i < num_spawns; i++)
+		{
+			// pull the closest remaining spawn into slot i
+			if (i > 0)
+			{
+				int32_t best = i;
+				
+				for (int32_t j = i + 1; j < num_spawns; j++)
+					if ((spawns[j] - spawns[i - 1]).lengthSquared() < (spawns[best] - spawns[i - 1]).lengthSquared())
+						best = j;
+				
+				std::swap(spawns[i], spawns[best]);
+			}
+			
+			map_trainer_t::rival_step_t &step = trainer.rival_route[trainer.rival_route_count++];
+			step.position = spawns[i];
+			step.time = i ? (trainer.rival_route[i - 1].time + MapTrainer_RivalTravelTime(spawns[i - 1], spawns[i])) : 0_ms;
+		}
+	}
+	
+	if (!trainer.rival_route_count)
+		return;
+	
+	// a lap starts by leaving the last step for the first one, so every
+	// step is due that much later, and the lap ends at the last step
+	const gtime_t lead = MapTrainer_RivalTravelTime(trainer.rival_route[trainer.rival_route_count - 1].position, trainer.rival_route[0].position);
+	
+	for (int32_t i = 0; i < trainer.rival_route_count; i++)
+		trainer.rival_route[i].time += lead;
+	
+	trainer.rival_route_period = max(trainer.rival_route[trainer.rival_route_count - 1].time, 1_sec);
+	trainer.rival_route_start = level.time;
+	trainer.rival_route_step = 0;
+	trainer.rival_route_updated = 0_ms;
+}
+
+void MapTrainer_RivalBotThink(edict_t *bot)
+{
+	map_trainer_t &trainer = level.map_trainer;
+	
+	if (!bot->client->map_trainer_rival || !trainer.rival_enabled || !trainer.rival_route_count)
+		return;
+	
+	// the move order doesn't survive respawning
+	if (bot->deadflag)
+	{
+		bot->client->map_trainer_rival_order = -1;
+		return;
+	}
+	
+	// shared by every rival; only the first one each frame moves it along
+	if (trainer.rival_route_updated != level.time)
+	{
+		trainer.rival_route_updated = level.time;
+		
+		while (level.time - trainer.rival_route_start >= trainer.rival_route_period)
+		{
+			trainer.rival_route_start += trainer.rival_route_period;
+			trainer.rival_route_step = 0;
+		}
+		
+		gtime_t elapsed = level.time - trainer.rival_route_start;
+		
+		// head for the first step we're not due at yet; a new lap
+		// heads for step 0 first
+		while (trainer.rival_route_step < trainer.rival_route_count && trainer.rival_route[trainer.rival_route_step].time <= elapsed)
+			trainer.rival_route_step++;
+	}
+	
+	const int32_t order = trainer.rival_route_step % trainer.rival_route_count;
+	
+	if (bot->client->map_trainer_rival_order == order)
+		return;
+	
+	bot->client->map_trainer_rival_order = order;
+	gi.Bot_MoveToPoint(bot, trainer.rival_route[order].position, 16.0f);
+}
+
+// Called from ClientConnect for every bot; true if it's one we asked for
+bool MapTrainer_ClaimRivalBot()
+{
+	if (level.map_trainer.rival_bots_pending <= 0)
+		return false;
+	
+	level.map_trainer.rival_bots_pending--;
+	return true;
+}
+
+static void MapTrainer_AddRivalBots()
+{
+	int32_t have = 0;
+	
+	for (uint32_t i = 0; i < game.maxclients; i++)
+		if (game.clients[i].pers.connected && game.clients[i].map_trainer_rival)
+		{
+			game.clients[i].map_trainer_rival_order = -1;
+			have++;
+		}
+	
+	level.map_trainer.rival_bots_pending = max(0, MAP_TRAINER_RIVAL_BOTS - have);
+	
+	for (int32_t i = 0; i < level.map_trainer.rival_bots_pending; i++)
+		gi.AddCommandString("addbot\n");
+}
+
+static void MapTrainer_RemoveRivalBots()
+{
+	level.map_trainer.rival_bots_pending = 0;
+	
+	// clients, not edicts; this also runs between levels
+	for (uint32_t i = 0; i < game.maxclients; i++)
+		if (game.clients[i].pers.connected && game.clients[i].map_trainer_rival)
+			gi.AddCommandString(G_Fmt("kick {}\n", i).data());
+}
+
+void MapTrainer_ToggleRivalBots(edict_t *ent, pmenuhnd_t *p)
+{
+	level.map_trainer.rival_enabled = !level.map_trainer.rival_enabled;
+	
+	if (level.map_trainer.rival_enabled)
+	{
+		MapTrainer_CompileRivalRoute();
+		
+		if (!level.map_trainer.rival_route_count)
+		{
+			level.map_trainer.rival_enabled = false;
+			gi.LocClient_Print(ent, PRINT_HIGH, "Rival Bots: no armor or megahealth on this map.");
+		}
+		else
+		{
+			MapTrainer_AddRivalBots();
+			
+			if (level.map_trainer.rival_history_count >= 2)
+				gi.LocClient_Print(ent, PRINT_HIGH, G_Fmt("Rival Bots enabled, replaying your {} recorded pickups.", level.map_trainer.rival_route_count).data());
+			else
+				gi.LocClient_Print(ent, PRINT_HIGH, G_Fmt("Rival Bots enabled, running {} armor/megahealth spawns. Pick some up yourself to record a route.", level.map_trainer.rival_route_count).data());
+		}
+	}
+	else
+	{
+		MapTrainer_RemoveRivalBots();
+		gi.LocClient_Print(ent, PRINT_HIGH, "Rival Bots disabled.");
+	}
+	
+	PMenu_Update(ent);
+}
+
 // ==================== MAP TRAINER MENU SYSTEM ====================
 
 void MapTrainer_MenuClose(edict_t *ent, pmenuhnd_t *p)
@@ -4795,6 +5050,14 @@ void MapTrainer_BackToMainMenu(edict_t *ent, pmenuhnd_t *p)
 	MapTrainer_OpenMenu(ent);
 }
 
+// Only touch the entry if its text actually changes; the menu
+// re-renders changed rows only, so unchanged ones cost nothing
+static void MapTrainer_SetEntryText(pmenu_t &entry, const char *text)
+{
+	if (strcmp(entry.text, text))
+		Q_strlcpy(entry.text, text, sizeof(entry.text));
+}
+
 void MapTrainer_UpdateItemPathingSubmenu(edict_t *ent)
 {
 	if (!ent->client->menu)
@@ -4803,17 +5066,17 @@ void MapTrainer_UpdateItemPathingSubmenu(edict_t *ent)
 	pmenu_t *entries = ent->client->menu->entries;
 	
 	// Update toggle display text
-	Q_strlcpy(entries[2].text, G_Fmt("Path Trainer: {}", level.map_trainer.training_enabled ? "Enabled" : "Disabled").data(), sizeof(entries[2].text));
+	MapTrainer_SetEntryText(entries[2], level.map_trainer.training_enabled ? "Path Trainer: Enabled" : "Path Trainer: Disabled");
 	
 	if (level.map_trainer.training_enabled)
 	{
 		// Show item category options when training is enabled
-		Q_strlcpy(entries[3].text, G_Fmt("Weapons: {}", level.map_trainer.weapons_enabled ? "ON" : "OFF").data(), sizeof(entries[3].text));
-		Q_strlcpy(entries[4].text, G_Fmt("Ammo: {}", level.map_trainer.ammo_enabled ? "ON" : "OFF").data(), sizeof(entries[4].text));
-		Q_strlcpy(entries[5].text, G_Fmt("Health: {}", level.map_trainer.health_enabled ? "ON" : "OFF").data(), sizeof(entries[5].text));
-		Q_strlcpy(entries[6].text, G_Fmt("Armor: {}", level.map_trainer.armor_enabled ? "ON" : "OFF").data(), sizeof(entries[6].text));
-		Q_strlcpy(entries[7].text, G_Fmt("Powerups: {}", level.map_trainer.powerups_enabled ? "ON" : "OFF").data(), sizeof(entries[7].text));
-		Q_strlcpy(entries[8].text, G_Fmt("Combine Health Packs: {}", level.map_trainer.combine_health_packs ? "ON" : "OFF").data(), sizeof(entries[8].text));
+		MapTrainer_SetEntryText(entries[3], level.map_trainer.weapons_enabled ? "Weapons: ON" : "Weapons: OFF");
+		MapTrainer_SetEntryText(entries[4], level.map_trainer.ammo_enabled ? "Ammo: ON" : "Ammo: OFF");
+		MapTrainer_SetEntryText(entries[5], level.map_trainer.health_enabled ? "Health: ON" : "Health: OFF");
+		MapTrainer_SetEntryText(entries[6], level.map_trainer.armor_enabled ? "Armor: ON" : "Armor: OFF");
+		MapTrainer_SetEntryText(entries[7], level.map_trainer.powerups_enabled ? "Powerups: ON" : "Powerups: OFF");
+		MapTrainer_SetEntryText(entries[8], level.map_trainer.combine_health_packs ? "Combine Health Packs: ON" : "Combine Health Packs: OFF");
 		
 		// Re-enable the function pointers
 		entries[3].SelectFunc = MapTrainer_ToggleWeapons;
@@ -4826,13 +5089,13 @@ void MapTrainer_UpdateItemPathingSubmenu(edict_t *ent)
 	else
 	{
 		// Hide item category options when training is disabled
-		Q_strlcpy(entries[3].text, "", sizeof(entries[3].text));
-		Q_strlcpy(entries[4].text, "", sizeof(entries[4].text));
-		Q_strlcpy(entries[5].text, "", sizeof(entries[5].text));
-		Q_strlcpy(entries[6].text, "", sizeof(entries[6].text));
-		Q_strlcpy(entries[7].text, "", sizeof(entries[7].text));
-		Q_strlcpy(entries[8].text, "", sizeof(entries[8].text));
-		Q_strlcpy(entries[9].text, "", sizeof(entries[9].text)); // Hide the blank line too
+		MapTrainer_SetEntryText(entries[3], "");
+		MapTrainer_SetEntryText(entries[4], "");
+		MapTrainer_SetEntryText(entries[5], "");
+		MapTrainer_SetEntryText(entries[6], "");
+		MapTrainer_SetEntryText(entries[7], "");
+		MapTrainer_SetEntryText(entries[8], "");
+		MapTrainer_SetEntryText(entries[9], ""); // Hide the blank line too
 		
 		// Disable the function pointers
 		entries[3].SelectFunc = nullptr;
@@ -4874,9 +5137,10 @@ void MapTrainer_UpdateItemTimingSubmenu(edict_t *ent)
 	pmenu_t *entries = ent->client->menu->entries;
 	
 	// Update toggle display text
-	Q_strlcpy(entries[2].text, G_Fmt("Timing Trainer: {}", level.map_trainer.timing_enabled ? "Enabled" : "Disabled").data(), sizeof(entries[2].text));
-	Q_strlcpy(entries[3].text, G_Fmt("Free Collect: {}", level.map_trainer.free_collect_enabled ? "ON" : "OFF").data(), sizeof(entries[3].text));
-	Q_strlcpy(entries[4].text, G_Fmt("Debug Prints: {}", level.map_trainer.timing_debug_enabled ? "ON" : "OFF").data(), sizeof(entries[4].text));
+	MapTrainer_SetEntryText(entries[2], level.map_trainer.timing_enabled ? "Timing Trainer: Enabled" : "Timing Trainer: Disabled");
+	MapTrainer_SetEntryText(entries[3], level.map_trainer.free_collect_enabled ? "Free Collect: ON" : "Free Collect: OFF");
+	MapTrainer_SetEntryText(entries[4], level.map_trainer.timing_debug_enabled ? "Debug Prints: ON" : "Debug Prints: OFF");
+	MapTrainer_SetEntryText(entries[5], level.map_trainer.rival_enabled ? "Rival Bots: ON" : "Rival Bots: OFF");
 }
 
 pmenu_t maptrainer_jumptrainer_submenu[] = {
@@ -4902,6 +5166,7 @@ pmenu_t maptrainer_itemtiming_submenu[] = {
 	{ "Timing Trainer: Disabled", PMENU_ALIGN_LEFT, MapTrainer_ToggleTiming },
 	{ "Free Collect: ON", PMENU_ALIGN_LEFT, MapTrainer_ToggleFreeCollect },
 	{ "Debug Prints: OFF", PMENU_ALIGN_LEFT, MapTrainer_ToggleTimingDebug },
+	{ "Rival Bots: OFF", PMENU_ALIGN_LEFT, MapTrainer_ToggleRivalBots },
 	{ "", PMENU_ALIGN_CENTER, nullptr },
 	{ "Back to Main Menu", PMENU_ALIGN_LEFT, MapTrainer_BackToMainMenu },
 	{ "", PMENU_ALIGN_CENTER, nullptr },
@@ -4922,7 +5187,7 @@ void MapTrainer_UpdateMenu(edict_t *ent)
 	pmenu_t *entries = ent->client->menu->entries;
 	
 	// Update speedometer display text (index 6 in the main menu - after adding Item Jump Trainer)
-	Q_strlcpy(entries[6].text, G_Fmt("Speedometer: {}", level.map_trainer.speedometer_enabled ? "ON" : "OFF").data(), sizeof(entries[6].text));
+	MapTrainer_SetEntryText(entries[6], level.map_trainer.speedometer_enabled ? "Speedometer: ON" : "Speedometer: OFF");
 }
 
 pmenu_t maptrainer_menu[] = {
@@ -4957,16 +5222,15 @@ void Cmd_MapTrainerMenu_f(edict_t *ent)
 // ==================== SPEEDOMETER SYSTEM ====================
 
 // Helper function to find existing timing entry for an item
-map_trainer_t::timing_entry_t* MapTrainer_FindTimingEntry(const char *classname)
+map_trainer_t::timing_entry_t* MapTrainer_FindTimingEntry(item_id_t id)
 {
-	if (!classname)
+	if (id == IT_NULL)
 		return nullptr;
 		
 	for (int32_t i = 0; i < level.map_trainer.MAX_TIMING_ENTRIES; i++)
 	{
 		if (level.map_trainer.timing_entries[i].active && 
-			level.map_trainer.timing_entries[i].item_classname &&
-			Q_strcasecmp(level.map_trainer.timing_entries[i].item_classname, classname) == 0)
+			level.map_trainer.timing_entries[i].item_id == id)
 		{
 			return &level.map_trainer.timing_entries[i];
 		}
@@ -4975,14 +5239,14 @@ map_trainer_t::timing_entry_t* MapTrainer_FindTimingEntry(const char *classname)
 }
 
 // Helper function to create or update timing entry for an item
-map_trainer_t::timing_entry_t* MapTrainer_CreateOrUpdateTimingEntry(const char *classname, const char *item_name, 
+map_trainer_t::timing_entry_t* MapTrainer_CreateOrUpdateTimingEntry(item_id_t id, const char *item_name, 
 	const vec3_t &position, gtime_t pickup_time, gtime_t respawn_time)
 {
-	if (!classname || !item_name)
+	if (id == IT_NULL || !item_name)
 		return nullptr;
 		
 	// First try to find existing entry
-	map_trainer_t::timing_entry_t* entry = MapTrainer_FindTimingEntry(classname);
+	map_trainer_t::timing_entry_t* entry = MapTrainer_FindTimingEntry(id);
 	
 	// If not found, create new entry
 	if (!entry)
@@ -5010,7 +5274,7 @@ map_trainer_t::timing_entry_t* MapTrainer_CreateOrUpdateTimingEntry(const char *
 	entry->respawn_time = respawn_time;
 	entry->grace_period_end = pickup_time + 5_sec;
 	entry->item_name = item_name;
-	entry->item_classname = classname;
+	entry->item_id = id;
 	
 	// Initialize megahealth fields to default values
 	entry->is_megahealth = false;
@@ -22,6 +22,8 @@ constexpr bool is_char_ptr_v = std::is_convertible_v<T, const char*>;
 template<typename T>
 constexpr bool is_valid_loc_embed_v = !std::is_null_pointer_v<T> && (std::is_floating_point_v<std::remove_reference_t<T>> || std::is_integral_v<std::remove_reference_t<T>> || is_char_ptr_v<T>);
 
+void G_TriggerLinkChanged(edict_t *ent);
+
 struct local_game_import_t : game_import_t
 {
 	inline local_game_import_t() = default;
@@ -149,6 +151,19 @@ public:
 		return game_import_t::clip(entity, start, nullptr, nullptr, end, contentmask);
 	}
 
+	// watch trigger links, for G_TouchTriggers' cache
+	inline void linkentity(edict_t *ent)
+	{
+		game_import_t::linkentity(ent);
+		G_TriggerLinkChanged(ent);
+	}
+
+	inline void unlinkentity(edict_t *ent)
+	{
+		game_import_t::unlinkentity(ent);
+		G_TriggerLinkChanged(ent);
+	}
+
 	void unicast(edict_t *ent, bool reliable, uint32_t dupe_key = 0)
 	{
 		game_import_t::unicast(ent, reliable, dupe_key);
@@ -1113,6 +1128,13 @@ struct level_entry_t
 	int32_t visit_order;
 };
 
+// one frame of a player's lag compensation history
+struct lag_sample_t
+{
+	vec3_t origin;
+	vec3_t mins, maxs;
+};
+
 //
 // this structure is left intact through an entire game
 // it should be initialized at dll load time, and read/written to
@@ -1143,7 +1165,7 @@ struct game_locals_t
 	int32_t airacceleration_modified, gravity_modified;
 	std::array<level_entry_t, MAX_LEVELS_PER_UNIT> level_entries;
 	int32_t max_lag_origins;
-	vec3_t *lag_origins; // maxclients * max_lag_origins
+	lag_sample_t *lag_origins; // maxclients * max_lag_origins
 };
 
 constexpr size_t MAX_HEALTH_BARS = 2;
@@ -1156,6 +1178,7 @@ struct map_trainer_item_t
 {
 	char friendly_name[64];
 	char class_name[64];
+	item_id_t id;
 	vec3_t position;
 };
 
@@ -1163,7 +1186,8 @@ struct map_trainer_unique_item_t
 {
 	char class_name[64];
 	char friendly_name[64];
-	int32_t *item_indices;  // Array of indices into main items array
+	item_id_t id;			// normalized; combined health packs share one
+	int32_t *item_indices;  // Indices into main items array; points into the unique_items block
 	int32_t instance_count; // Number of instances of this item type
 };
 
@@ -1209,7 +1233,7 @@ struct map_trainer_t
 		gtime_t respawn_time;
 		gtime_t grace_period_end;
 		const char *item_name;
-		const char *item_classname; // Used as unique identifier
+		item_id_t item_id; // Used as unique identifier
 		
 		// Megahealth-specific fields
 		bool is_megahealth;
@@ -1220,6 +1244,24 @@ struct map_trainer_t
 	static constexpr int32_t MAX_TIMING_ENTRIES = 32; // Support up to 32 concurrent timings
 	timing_entry_t timing_entries[MAX_TIMING_ENTRIES];
 	int32_t timing_entry_count;
+	// Rival bots - contested pickups recorded from human players, and the
+	// route compiled from them that bots replay
+	struct rival_step_t {
+		vec3_t position;
+		gtime_t time; // offset from the first pickup of the lap
+	};
+	static constexpr int32_t MAX_RIVAL_STEPS = 32;
+	rival_step_t rival_history[MAX_RIVAL_STEPS];
+	int32_t rival_history_count;
+	gtime_t rival_history_start;
+	bool rival_enabled;
+	rival_step_t rival_route[MAX_RIVAL_STEPS];
+	int32_t rival_route_count;
+	gtime_t rival_route_period; // length of one lap
+	gtime_t rival_route_start; // level time the current lap started
+	int32_t rival_route_step; // step every rival is heading to
+	gtime_t rival_route_updated; // last frame rival_route_step was advanced
+	int32_t rival_bots_pending; // bots we asked for that haven't connected yet
 };
 
 //
@@ -1334,7 +1376,10 @@ struct shadow_light_temp_t
 
 void G_LoadShadowLights();
 
-#include <unordered_set>
+#include <bitset>
+
+// one bit per spawn key in spawn_temp_t::keys_specified
+constexpr size_t MAX_SPAWN_KEYS = 256;
 
 // spawn_temp_t is only used to hold entity field values that
 // can be set from the editor, but aren't actualy present
@@ -1385,12 +1430,11 @@ struct spawn_temp_t
 	const char *noise_start, *noise_middle, *noise_end; // [Paril-KEX]
 	int32_t loop_count; // [Paril-KEX]
 
-	std::unordered_set<const char *> keys_specified;
+	// indexed by spawn key; see ED_ParseField
+	std::bitset<MAX_SPAWN_KEYS> keys_specified;
 
-	inline bool was_key_specified(const char *key) const
-	{
-		return keys_specified.find(key) != keys_specified.end();
-	}
+	bool was_key_specified(const char *key) const;
+	void mark_key_specified(const char *key);
 };
 
 enum move_state_t
@@ -1769,6 +1813,7 @@ struct monsterinfo_t
 	gtime_t	  path_wait_time; // don't try nav nodes until this is over
 	PathInfo  nav_path; // if AI_PATHING, this is where we are trying to reach
 	gtime_t	  nav_path_cache_time; // cache nav_path result for this much time
+	bool	  nav_path_queued; // a re-path is waiting in the nav request queue
 	combat_style_t combat_style; // pathing style
 
 	edict_t   *damage_attacker;
@@ -1985,6 +2030,8 @@ extern cvar_t *bob_roll;
 
 extern cvar_t *sv_cheats;
 extern cvar_t *g_debug_monster_paths;
+extern cvar_t *g_debug_nav_path_cache;
+extern cvar_t *g_debug_triggers;
 extern cvar_t *g_debug_monster_kills;
 extern cvar_t *maxspectators;
 
@@ -2116,16 +2163,20 @@ void      MapTrainer_LoadCSV(const char *mapname);
 void      MapTrainer_BuildUniqueItemsList();
 void      MapTrainer_PickNewTarget();
 bool      MapTrainer_IsTargetItem(edict_t *ent);
-bool      MapTrainer_IsItemCategoryEnabled(const char *class_name);
-bool      MapTrainer_IsItemAvailable(const char *class_name, const vec3_t &position);
+bool      MapTrainer_IsItemCategoryEnabled(item_id_t id);
+bool      MapTrainer_IsItemAvailable(item_id_t id, const vec3_t &position);
+bool      MapTrainer_GetTimingInfo(const gitem_t *item, const char *&item_name, gtime_t &respawn_time);
 void      MapTrainer_OnItemPickup(edict_t *item_ent, edict_t *player);
 void      MapTrainer_ShowWelcomeMessage(edict_t *player);
 void      MapTrainer_OpenMenu(edict_t *ent);
 void      MapTrainer_UpdateSpeedometer(edict_t *player);
 void      MapTrainer_CheckArmorTiming(edict_t *player);
 void      MapTrainer_CheckMegahealthTiming(edict_t *player);
-map_trainer_t::timing_entry_t* MapTrainer_FindTimingEntry(const char *classname);
-map_trainer_t::timing_entry_t* MapTrainer_CreateOrUpdateTimingEntry(const char *classname, const char *item_name, 
+void      MapTrainer_RecordRivalPickup(edict_t *item_ent, edict_t *player);
+void      MapTrainer_RivalBotThink(edict_t *bot);
+bool      MapTrainer_ClaimRivalBot();
+map_trainer_t::timing_entry_t* MapTrainer_FindTimingEntry(item_id_t id);
+map_trainer_t::timing_entry_t* MapTrainer_CreateOrUpdateTimingEntry(item_id_t id, const char *item_name, 
 	const vec3_t &position, gtime_t pickup_time, gtime_t respawn_time);
 void      Cmd_MapTrainerMenu_f(edict_t *ent);
 void      Cmd_SetSpawn_f(edict_t *ent);
@@ -2156,9 +2207,15 @@ edict_t *G_FindByString(edict_t *from, const std::string_view &value)
 }
 
 edict_t *findradius(edict_t *from, const vec3_t &org, float rad);
+size_t	 G_FindRadiusLinked(const vec3_t &org, float rad, edict_t **list, size_t maxcount);
 edict_t *G_PickTarget(const char *targetname);
 void	 G_UseTargets(edict_t *ent, edict_t *activator);
 void	 G_PrintActivationMessage(edict_t *ent, edict_t *activator, bool coop_global);
+void	 G_TempEntity_Impact(temp_event_t type, const vec3_t &origin, const vec3_t &dir, multicast_t to = MULTICAST_PVS);
+void	 G_TempEntity_Beam(temp_event_t type, const vec3_t &start, const vec3_t &end, multicast_t to);
+void	 G_TempEntity_Flush();
+void	 G_TempEntity_Clear();
+void	 G_TriggerCache_Clear();
 void	 G_SetMovedir(vec3_t &angles, vec3_t &movedir);
 
 void	 G_InitEdict(edict_t *e);
@@ -2181,7 +2238,8 @@ void G_PlayerNotifyGoal(edict_t *player);
 // g_spawn.c
 //
 void  ED_CallSpawn(edict_t *ent);
-char *ED_NewString(char *string);
+char *ED_NewString(const char *string);
+void  ED_ResetStringArena(size_t reserve);
 
 //
 // g_target.c
@@ -2292,6 +2350,11 @@ bool M_droptofloor(edict_t *ent);
 void monster_think(edict_t *self);
 void monster_dead_think(edict_t *self);
 void monster_dead(edict_t *self);
+void G_Corpse_Clear();
+void G_Corpse_Add(edict_t *ent);
+void G_Corpse_Remove(edict_t *ent);
+void G_Corpse_Rebuild();
+void G_FindCorpses(const vec3_t &org, float rad, std::vector<edict_t *> &out);
 void walkmonster_start(edict_t *self);
 void swimmonster_start(edict_t *self);
 void flymonster_start(edict_t *self);
@@ -2510,6 +2573,8 @@ struct select_spawn_result_t
 };
 
 select_spawn_result_t SelectDeathmatchSpawnPoint(bool farthest, bool force_spawn, bool fallback_to_ctf_or_start);
+const std::vector<edict_t *> &G_SpawnPointsOfClass(const char *classname);
+void G_SpawnPoints_Invalidate();
 void G_PostRespawn(edict_t *self);
 
 //
@@ -2529,6 +2594,7 @@ bool SV_FilterPacket(const char *from);
 void ClientEndServerFrame(edict_t *ent);
 void G_LagCompensate(edict_t *from_player, const vec3_t &start, const vec3_t &dir);
 void G_UnLagCompensate();
+trace_t G_LagTraceLine(const vec3_t &start, const vec3_t &end, edict_t *passent, contents_t mask);
 
 //
 // p_hud.c
@@ -2586,6 +2652,8 @@ bool M_walkmove(edict_t *ent, float yaw, float dist);
 void M_MoveToGoal(edict_t *ent, float dist);
 void M_ChangeYaw(edict_t *ent);
 bool ai_check_move(edict_t *self, float dist);
+void M_NavPathQueue_Clear();
+void M_NavPathQueue_Run();
 
 //
 // g_phys.c
@@ -2595,7 +2663,10 @@ constexpr float sv_waterfriction = 1;
 
 void G_RunEntity(edict_t *ent);
 bool SV_RunThink(edict_t *ent);
+void G_ThinkWheel_Clear();
+void G_ThinkWheel_Advance();
 void SV_AddRotationalFriction(edict_t *ent);
+void SV_WakeEntity(edict_t *ent);
 void SV_AddGravity(edict_t *ent);
 void SV_CheckVelocity(edict_t *ent);
 void	SV_FlyMove(edict_t *ent, float time, contents_t mask);
@@ -3083,8 +3154,8 @@ struct gclient_t
 	// saved positions for lag compensation
 	uint8_t	 num_lag_origins; // 0 to MAX_LAG_ORIGINS, how many we can go back
 	uint8_t  next_lag_origin; // the next one to write to
-	bool     is_lag_compensated;
-	vec3_t	 lag_restore_origin;
+	uint32_t lag_cmd_frame; // server_frame of the last usercmd
+	uint32_t lag_cmd_msec;	// msec of usercmds sent since the client got lag_cmd_frame
 	// for high tickrate weapon angles
 	vec3_t	 slow_view_angles;
 	gtime_t	 slow_view_angle_time;
@@ -3096,6 +3167,8 @@ struct gclient_t
 	uint32_t step_frame;
 	int32_t help_poi_image;
 	vec3_t help_poi_location;
+	bool map_trainer_rival; // bot spawned by the map trainer to run the rival route
+	int32_t map_trainer_rival_order; // route step last ordered, -1 if none
 
 	// only set temporarily
 	bool awaiting_respawn;
@@ -3125,6 +3198,20 @@ MAKE_ENUM_BITFLAGS(plat2flags_t);
 
 #include <bitset>
 
+// edict_t::nextthink; a gtime_t that reports every write to the
+// think wheel, so due thinks are found without polling each edict.
+// raw writes (memset, save loading) must reschedule by hand.
+struct think_time_t : gtime_t
+{
+	think_time_t() = default;
+	// only ever lives inside an edict
+	think_time_t(const think_time_t &) = delete;
+	inline think_time_t &operator=(const think_time_t &t) { return *this = static_cast<const gtime_t &>(t); }
+	inline think_time_t &operator=(const gtime_t &t);
+	inline think_time_t &operator+=(const gtime_t &t) { return *this = *this + t; }
+	inline think_time_t &operator-=(const gtime_t &t) { return *this = *this - t; }
+};
+
 struct edict_t
 {
 	edict_t() = delete;
@@ -3201,7 +3288,7 @@ struct edict_t
 	float	 yaw_speed;
 	float	 ideal_yaw;
 
-	gtime_t nextthink;
+	think_time_t nextthink;
 	save_prethink_t prethink;
 	save_prethink_t postthink;
 	save_think_t think;
@@ -3240,6 +3327,10 @@ struct edict_t
 	edict_t *activator;
 	edict_t *groundentity;
 	int32_t	 groundentity_linkcount;
+	// physics sleep; frames spent at rest, and our own linkcount
+	// when that started. not saved, everything wakes on load
+	int32_t	 rest_frames;
+	int32_t	 rest_linkcount;
 	edict_t *teamchain;
 	edict_t *teammaster;
 
@@ -3267,6 +3358,7 @@ struct edict_t
 	int32_t style; // also used as areaportal number
 
 	gitem_t *item; // for bonus items
+	gtime_t	 item_respawn_time; // when a hidden item comes back; set by SetRespawn, cleared by DoRespawn
 
 	// common data blocks
 	moveinfo_t	  moveinfo;
@@ -3339,6 +3431,15 @@ struct edict_t
 	// in g_save.cpp too!
 };
 
+void G_ThinkWheel_Schedule(edict_t *ent);
+
+inline think_time_t &think_time_t::operator=(const gtime_t &t)
+{
+	gtime_t::operator=(t);
+	G_ThinkWheel_Schedule(reinterpret_cast<edict_t *>(reinterpret_cast<uint8_t *>(this) - offsetof(edict_t, nextthink)));
+	return *this;
+}
+
 //=============
 // ROGUE
 constexpr spawnflags_t SPHERE_DEFENDER = 0x0001_spawnflag;
@@ -3538,6 +3639,74 @@ inline entity_iterable_t<active_players_filter_t> active_players()
 	return entity_iterable_t<active_players_filter_t> { 1u, game.maxclients };
 }
 
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// find first set bit of a non-zero word
+inline uint32_t Q_ctz64(uint64_t v)
+{
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward64(&index, v);
+	return (uint32_t) index;
+#else
+	return (uint32_t) __builtin_ctzll(v);
+#endif
+}
+
+// one bit per edict number
+struct edict_bitset_t
+{
+	std::vector<uint64_t> words;
+
+	inline void resize(size_t num_bits) { words.assign((num_bits + 63) / 64, 0); }
+	inline void clear() { std::fill(words.begin(), words.end(), 0); }
+
+	inline bool test(uint32_t i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+	inline void set(uint32_t i) { words[i >> 6] |= 1ull << (i & 63); }
+	inline void reset(uint32_t i) { words[i >> 6] &= ~(1ull << (i & 63)); }
+	inline void set(uint32_t i, bool value) { if (value) set(i); else reset(i); }
+
+	// first set bit in [i, end), or end if there are none.
+	// reads the words fresh each call, so bits changed while
+	// iterating are respected.
+	inline uint32_t next(uint32_t i, uint32_t end) const
+	{
+		while (i < end)
+		{
+			uint64_t w = words[i >> 6] >> (i & 63);
+
+			if (w)
+				return std::min(i + Q_ctz64(w), end);
+
+			i = (i | 63) + 1;
+		}
+
+		return end;
+	}
+};
+
+// compact mirror of per-edict state that the frame loop
+// tests every frame. kept in sync at spawn, free and load
+// so frame passes can skip straight to the live indices
+// instead of striding over whole edict_t's.
+struct edict_hot_t
+{
+	edict_bitset_t inuse;	// non-client edicts only; clients are walked directly
+	edict_bitset_t monster; // superset of SVF_MONSTER; re-checked by users
+	edict_bitset_t think_due; // superset of 0 < nextthink <= level.time; set by the think wheel
+	edict_bitset_t projectile; // superset of SVF_PROJECTILE; re-checked by users
+	edict_bitset_t trigger; // linked as SOLID_TRIGGER; set by G_TriggerLinkChanged
+};
+
+extern edict_hot_t g_edict_hot;
+
+void G_EdictHot_Init();
+void G_EdictHot_Clear();
+void G_EdictHot_Sync(edict_t *ent);
+
 struct gib_def_t
 {
 	size_t count;
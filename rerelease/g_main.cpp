@@ -68,6 +68,8 @@ cvar_t *bob_roll;
 cvar_t *sv_cheats;
 
 cvar_t *g_debug_monster_paths;
+cvar_t *g_debug_nav_path_cache;
+cvar_t *g_debug_triggers;
 cvar_t *g_debug_monster_kills;
 
 cvar_t *bot_debug_follow_actor;
@@ -258,6 +260,8 @@ void InitGame()
 	g_grapple_damage = gi.cvar("g_grapple_damage", "10", CVAR_NOFLAGS);
 
 	g_debug_monster_paths = gi.cvar("g_debug_monster_paths", "0", CVAR_NOFLAGS);
+	g_debug_nav_path_cache = gi.cvar("g_debug_nav_path_cache", "0", CVAR_NOFLAGS);
+	g_debug_triggers = gi.cvar("g_debug_triggers", "0", CVAR_NOFLAGS);
 	g_debug_monster_kills = gi.cvar("g_debug_monster_kills", "0", CVAR_LATCH);
 
 	bot_debug_follow_actor = gi.cvar("bot_debug_follow_actor", "0", CVAR_NOFLAGS);
@@ -362,6 +366,7 @@ void InitGame()
 	g_edicts = (edict_t *) gi.TagMalloc(game.maxentities * sizeof(g_edicts[0]), TAG_GAME);
 	globals.edicts = g_edicts;
 	globals.max_edicts = game.maxentities;
+	G_EdictHot_Init();
 
 	// initialize all clients for this game
 	game.maxclients = maxclients->integer;
@@ -377,7 +382,7 @@ void InitGame()
 	
 	// how far back we should support lag origins for
 	game.max_lag_origins = 20 * (0.1f / gi.frame_time_s);
-	game.lag_origins = (vec3_t *) gi.TagMalloc(game.maxclients * sizeof(vec3_t) * game.max_lag_origins, TAG_GAME);
+	game.lag_origins = (lag_sample_t *) gi.TagMalloc(game.maxclients * sizeof(lag_sample_t) * game.max_lag_origins, TAG_GAME);
 }
 
 //===================================================================
@@ -468,6 +473,9 @@ void ClientEndServerFrames()
 {
 	edict_t *ent;
 
+	// everything that went off this frame goes out together
+	G_TempEntity_Flush();
+
 	// calc the player views now that all pushing
 	// and damage has been added
 	for (uint32_t i = 0; i < game.maxclients; i++)
@@ -813,6 +821,76 @@ static bool G_AnyDeadPlayersWithoutLives()
 	return false;
 }
 
+/*
+================
+G_RunFrame_Edict
+
+Per-edict body of the frame loop
+================
+*/
+static inline void G_RunFrame_Edict(uint32_t i, bool publish_bot_state)
+{
+	edict_t *ent = &g_edicts[i];
+
+	if (!ent->inuse)
+	{
+		// defer removing client info so that disconnected, etc works
+		if (i > 0 && i <= game.maxclients)
+		{
+			if (ent->timestamp && level.time < ent->timestamp)
+			{
+				int32_t playernum = ent - g_edicts - 1;
+				gi.configstring(CS_PLAYERSKINS + playernum, "");
+				ent->timestamp = 0_sec;
+			}
+		}
+		return;
+	}
+
+	level.current_entity = ent;
+
+	// Paril: RF_BEAM entities update their old_origin by hand.
+	if (!(ent->s.renderfx & RF_BEAM))
+		ent->s.old_origin = ent->s.origin;
+
+	// if the ground entity moved, make sure we are still on it
+	if ((ent->groundentity) && (ent->groundentity->linkcount != ent->groundentity_linkcount))
+	{
+		contents_t mask = G_GetClipMask(ent);
+
+		if (!(ent->flags & (FL_SWIM | FL_FLY)) && (ent->svflags & SVF_MONSTER))
+		{
+			ent->groundentity = nullptr;
+			M_CheckGround(ent, mask);
+		}
+		else
+		{
+			// if it's still 1 point below us, we're good
+			trace_t tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin + ent->gravityVector, ent,
+								  mask);
+
+			if (tr.startsolid || tr.allsolid || tr.ent != ent->groundentity)
+				ent->groundentity = nullptr;
+			else
+				ent->groundentity_linkcount = ent->groundentity->linkcount;
+		}
+	}
+
+	if (publish_bot_state)
+		Entity_UpdateState( ent );
+
+	if (i > 0 && i <= game.maxclients)
+	{
+		ClientBeginServerFrame(ent);
+		return;
+	}
+
+	G_RunEntity(ent);
+
+	// pick up any svflags changes made while running
+	G_EdictHot_Sync(ent);
+}
+
 /*
 ================
 G_RunFrame
@@ -830,6 +908,8 @@ inline void G_RunFrame_(bool main_loop)
 
 	level.time += FRAME_TIME_MS;
 
+	G_ThinkWheel_Advance();
+
 	if (level.intermission_fading)
 	{
 		if (level.intermission_fade_time > level.time)
@@ -850,8 +930,6 @@ inline void G_RunFrame_(bool main_loop)
 		return;
 	}
 
-	edict_t *ent;
-
 	// exit intermissions
 
 	if (level.exitintermission)
@@ -886,67 +964,25 @@ inline void G_RunFrame_(bool main_loop)
 		}
 	}
 
+	// hand out this frame's monster path requests
+	M_NavPathQueue_Run();
+
+	// sv state is only for bots; don't bother without any
+	const bool publish_bot_state = Bot_StatePublishingActive();
+
 	//
 	// treat each object in turn
 	// even the world gets a chance to think
 	//
-	ent = &g_edicts[0];
-	for (uint32_t i = 0; i < globals.num_edicts; i++, ent++)
-	{
-		if (!ent->inuse)
-		{
-			// defer removing client info so that disconnected, etc works
-			if (i > 0 && i <= game.maxclients)
-			{
-				if (ent->timestamp && level.time < ent->timestamp)
-				{
-					int32_t playernum = ent - g_edicts - 1;
-					gi.configstring(CS_PLAYERSKINS + playernum, "");
-					ent->timestamp = 0_sec;
-				}
-			}
-			continue;
-		}
-
-		level.current_entity = ent;
-
-		// Paril: RF_BEAM entities update their old_origin by hand.
-		if (!(ent->s.renderfx & RF_BEAM))
-			ent->s.old_origin = ent->s.origin;
-
-		// if the ground entity moved, make sure we are still on it
-		if ((ent->groundentity) && (ent->groundentity->linkcount != ent->groundentity_linkcount))
-		{
-			contents_t mask = G_GetClipMask(ent);
+	// the world and client slots are walked directly; past those
+	// only live edicts are visited. num_edicts is re-read every
+	// step so anything spawned this frame is still picked up.
+	for (uint32_t i = 0; i <= game.maxclients; i++)
+		G_RunFrame_Edict(i, publish_bot_state);
 
-			if (!(ent->flags & (FL_SWIM | FL_FLY)) && (ent->svflags & SVF_MONSTER))
-			{
-				ent->groundentity = nullptr;
-				M_CheckGround(ent, mask);
-			}
-			else
-			{
-				// if it's still 1 point below us, we're good
-				trace_t tr = gi.trace(ent->s.origin, ent->mins, ent->maxs, ent->s.origin + ent->gravityVector, ent,
-									  mask);
-
-				if (tr.startsolid || tr.allsolid || tr.ent != ent->groundentity)
-					ent->groundentity = nullptr;
-				else
-					ent->groundentity_linkcount = ent->groundentity->linkcount;
-			}
-		}
-
-		Entity_UpdateState( ent );
-
-		if (i > 0 && i <= game.maxclients)
-		{
-			ClientBeginServerFrame(ent);
-			continue;
-		}
-
-		G_RunEntity(ent);
-	}
+	for (uint32_t i = g_edict_hot.inuse.next(game.maxclients + 1, globals.num_edicts); i < globals.num_edicts;
+		 i = g_edict_hot.inuse.next(i + 1, globals.num_edicts))
+		G_RunFrame_Edict(i, publish_bot_state);
 
 	// see if it is time to end a deathmatch
 	CheckDMRules();
@@ -986,7 +1022,8 @@ inline void G_RunFrame_(bool main_loop)
 		level.entry->time += FRAME_TIME_S;
 
 	// [Paril-KEX] run monster pains now
-	for (uint32_t i = 0; i < globals.num_edicts + 1 + game.maxclients + BODY_QUEUE_SIZE; i++)
+	for (uint32_t i = g_edict_hot.monster.next(0, globals.num_edicts); i < globals.num_edicts;
+		 i = g_edict_hot.monster.next(i + 1, globals.num_edicts))
 	{
 		edict_t *e = &g_edicts[i];
 
@@ -1501,6 +1501,7 @@ void SP_misc_deadsoldier(edict_t *ent)
 	ent->takedamage = true;
 	// nb: SVF_MONSTER is here so it bleeds
 	ent->svflags |= SVF_MONSTER | SVF_DEADMONSTER;
+	G_EdictHot_Sync(ent);
 	ent->die = misc_deadsoldier_die;
 	ent->monsterinfo.aiflags |= AI_GOOD_GUY | AI_DO_NOT_COUNT;
 
@@ -699,6 +699,7 @@ void M_ProcessPain(edict_t *e)
 		}
 
 		e->die(e, e->monsterinfo.damage_inflictor, e->monsterinfo.damage_attacker, e->monsterinfo.damage_blood, e->monsterinfo.damage_from, e->monsterinfo.damage_mod);
+		G_Corpse_Add(e);
 		
 		// [Paril-KEX] medic commander only gets his slots back after the monster is gibbed, since we can revive them
 		if (e->health <= e->gib_health)
@@ -779,6 +780,99 @@ THINK(monster_dead_think) (edict_t *self) -> void
 	self->nextthink = level.time + 10_hz;
 }
 
+/*
+=================
+CORPSE REGISTRY
+
+Dead monsters, for medics and fixbots looking for someone to bring
+back. Monsters are added when they die and removed when they're
+freed or brought back; anything that stopped being a dead monster
+some other way (gibbed into a head, etc) drops out when it's found.
+=================
+*/
+static std::vector<edict_t *> corpse_list;
+static std::vector<int32_t>	  corpse_slot; // index into corpse_list by entity number, or -1
+
+static bool G_Corpse_Valid(const edict_t *ent)
+{
+	return ent->inuse && (ent->svflags & SVF_MONSTER) && ent->health <= 0;
+}
+
+void G_Corpse_Clear()
+{
+	corpse_list.clear();
+	corpse_slot.assign(game.maxentities, -1);
+}
+
+void G_Corpse_Add(edict_t *ent)
+{
+	if (!G_Corpse_Valid(ent) || (size_t) ent->s.number >= corpse_slot.size() || corpse_slot[ent->s.number] != -1)
+		return;
+
+	corpse_slot[ent->s.number] = (int32_t) corpse_list.size();
+	corpse_list.push_back(ent);
+}
+
+void G_Corpse_Remove(edict_t *ent)
+{
+	if ((size_t) ent->s.number >= corpse_slot.size())
+		return;
+
+	int32_t slot = corpse_slot[ent->s.number];
+
+	if (slot == -1)
+		return;
+
+	corpse_list[slot] = corpse_list.back();
+	corpse_slot[corpse_list[slot]->s.number] = slot;
+	corpse_list.pop_back();
+	corpse_slot[ent->s.number] = -1;
+}
+
+// after a level is loaded from a save
+void G_Corpse_Rebuild()
+{
+	G_Corpse_Clear();
+
+	for (size_t i = game.maxclients + 1; i < globals.num_edicts; i++)
+		G_Corpse_Add(&g_edicts[i]);
+}
+
+/*
+=================
+G_FindCorpses
+
+Fills out with every dead monster findradius would return
+for org/rad, in entity order.
+=================
+*/
+void G_FindCorpses(const vec3_t &org, float rad, std::vector<edict_t *> &out)
+{
+	out.clear();
+
+	for (size_t i = 0; i < corpse_list.size(); )
+	{
+		edict_t *ent = corpse_list[i];
+
+		if (!G_Corpse_Valid(ent))
+		{
+			G_Corpse_Remove(ent);
+			continue;
+		}
+
+		i++;
+
+		if (ent->solid == SOLID_NOT)
+			continue;
+		if ((org - (ent->s.origin + (ent->mins + ent->maxs) * 0.5f)).length() > rad)
+			continue;
+
+		out.push_back(ent);
+	}
+
+	std::sort(out.begin(), out.end());
+}
+
 void monster_dead(edict_t *self)
 {
 	self->think = monster_dead_think;
@@ -1256,6 +1350,7 @@ bool monster_start(edict_t *self)
 
 	self->nextthink = level.time + FRAME_TIME_S;
 	self->svflags |= SVF_MONSTER;
+	G_EdictHot_Sync(self);
 	self->takedamage = true;
 	self->air_finished = level.time + 12_sec;
 	self->use = monster_use;
@@ -1513,6 +1608,8 @@ void monster_start_go(edict_t *self)
 		if (!self->inuse)
 			return;
 
+		G_Corpse_Add(self);
+
 		if (self->monsterinfo.setskin)
 			self->monsterinfo.setskin(self);
 
@@ -89,6 +89,144 @@ void SV_CheckVelocity(edict_t *ent)
 		ent->velocity = (ent->velocity / speed) * sv_maxvelocity->value;
 }
 
+/*
+===============================================================================
+
+THINK WHEEL
+
+Hierarchical timer wheel keyed on nextthink, in frames. Every write
+to nextthink drops an entry in; as frames pass, entries that come due
+set the edict's think_due bit, and SV_RunThink only looks at edicts
+with that bit set. Dispatch itself still happens from G_RunEntity, so
+thinks keep running in edict order at the same point in physics.
+
+Entries are never removed; a stale one (edict freed, or nextthink
+rewritten since) is dropped when it no longer matches nextthink.
+
+===============================================================================
+*/
+
+constexpr uint32_t THINK_WHEEL_BITS = 6;
+constexpr uint32_t THINK_WHEEL_SLOTS = 1 << THINK_WHEEL_BITS;
+constexpr uint32_t THINK_WHEEL_LEVELS = 4;
+
+struct think_wheel_entry_t
+{
+	uint32_t number;
+	int64_t	 tick;
+	int64_t	 time_ms;
+};
+
+static struct
+{
+	std::array<std::array<std::vector<think_wheel_entry_t>, THINK_WHEEL_SLOTS>, THINK_WHEEL_LEVELS> slots;
+	std::vector<think_wheel_entry_t> cascade;
+	int64_t tick; // last frame processed
+} think_wheel;
+
+inline int64_t G_ThinkWheel_Tick(int64_t time_ms)
+{
+	const int64_t frame_ms = FRAME_TIME_MS.milliseconds();
+
+	return (time_ms + frame_ms - 1) / frame_ms;
+}
+
+static void G_ThinkWheel_Insert(const think_wheel_entry_t &entry)
+{
+	int64_t delta = entry.tick - think_wheel.tick;
+
+	for (uint32_t l = 0; l < THINK_WHEEL_LEVELS; l++)
+	{
+		if (delta < (1ll << (THINK_WHEEL_BITS * (l + 1))))
+		{
+			think_wheel.slots[l][(entry.tick >> (THINK_WHEEL_BITS * l)) & (THINK_WHEEL_SLOTS - 1)].push_back(entry);
+			return;
+		}
+	}
+
+	// past the top level; park it in the furthest slot and
+	// let it cascade back around until it fits
+	constexpr uint32_t top = THINK_WHEEL_BITS * (THINK_WHEEL_LEVELS - 1);
+	think_wheel.slots[THINK_WHEEL_LEVELS - 1][((think_wheel.tick >> top) - 1) & (THINK_WHEEL_SLOTS - 1)].push_back(entry);
+}
+
+void G_ThinkWheel_Clear()
+{
+	for (auto &level_slots : think_wheel.slots)
+		for (auto &slot : level_slots)
+			slot.clear();
+
+	think_wheel.tick = level.time.milliseconds() / FRAME_TIME_MS.milliseconds();
+	g_edict_hot.think_due.clear();
+}
+
+void G_ThinkWheel_Schedule(edict_t *ent)
+{
+	uint32_t number = ent - g_edicts;
+	int64_t	 time_ms = ent->nextthink.milliseconds();
+
+	if (time_ms <= 0)
+	{
+		g_edict_hot.think_due.reset(number);
+		return;
+	}
+
+	int64_t tick = G_ThinkWheel_Tick(time_ms);
+
+	if (tick <= think_wheel.tick)
+	{
+		g_edict_hot.think_due.set(number);
+		return;
+	}
+
+	g_edict_hot.think_due.reset(number);
+	G_ThinkWheel_Insert({ number, tick, time_ms });
+}
+
+static void G_ThinkWheel_Expire(std::vector<think_wheel_entry_t> &slot)
+{
+	// swap out first; re-inserting may land in this same slot
+	think_wheel.cascade.swap(slot);
+
+	for (auto &entry : think_wheel.cascade)
+	{
+		if (entry.tick > think_wheel.tick)
+		{
+			G_ThinkWheel_Insert(entry);
+			continue;
+		}
+
+		edict_t *ent = &g_edicts[entry.number];
+
+		if (ent->inuse && ent->nextthink.milliseconds() == entry.time_ms)
+			g_edict_hot.think_due.set(entry.number);
+	}
+
+	think_wheel.cascade.clear();
+}
+
+// move the wheel up to level.time, marking everything due
+void G_ThinkWheel_Advance()
+{
+	int64_t target = level.time.milliseconds() / FRAME_TIME_MS.milliseconds();
+
+	while (think_wheel.tick < target)
+	{
+		int64_t tick = ++think_wheel.tick;
+
+		// pull down any higher level whose slot just rolled over
+		for (uint32_t l = THINK_WHEEL_LEVELS - 1; l > 0; l--)
+		{
+			uint32_t shift = THINK_WHEEL_BITS * l;
+
+			if (!(tick & ((1ll << shift) - 1)))
+				G_ThinkWheel_Expire(think_wheel.slots[l][(tick >> shift) & (THINK_WHEEL_SLOTS - 1)]);
+		}
+
+		G_ThinkWheel_Expire(think_wheel.slots[0][tick & (THINK_WHEEL_SLOTS - 1)]);
+	}
+}
+
 /*
 =============
 SV_RunThink
@@ -98,11 +236,18 @@ Runs thinking code for this frame if necessary
 */
 bool SV_RunThink(edict_t *ent)
 {
-	gtime_t thinktime = ent->nextthink;
-	if (thinktime <= 0_ms)
+	uint32_t number = ent - g_edicts;
+
+	// the think wheel marks everything that could be due
+	if (!g_edict_hot.think_due.test(number))
 		return true;
-	if (thinktime > level.time)
+
+	gtime_t thinktime = ent->nextthink;
+	if (thinktime <= 0_ms || thinktime > level.time)
+	{
+		g_edict_hot.think_due.reset(number);
 		return true;
+	}
 
 	ent->nextthink = 0_ms;
 	if (!ent->think)
@@ -112,6 +257,58 @@ bool SV_RunThink(edict_t *ent)
 	return false;
 }
 
+/*
+===============================================================================
+
+SLEEP
+
+Step entities that have sat still on an unmoving ground for a while
+stop running their physics; toss entities already skip theirs while on
+the ground. Every frame they still re-check the cheap conditions on the
+edict: no velocity, our linkcount and the ground's linkcount unchanged.
+Anything that moves, relinks, damages or pushes them wakes them back up.
+
+===============================================================================
+*/
+
+constexpr int32_t SV_SLEEP_FRAMES = 8;
+
+void SV_WakeEntity(edict_t *ent)
+{
+	ent->rest_frames = 0;
+}
+
+// returns true if the entity is asleep and can skip its physics
+static bool SV_CheckSleep(edict_t *ent)
+{
+	edict_t *ground = ent->groundentity;
+
+	bool at_rest = ground && ground->inuse &&
+		ground->linkcount == ent->groundentity_linkcount &&
+		(ground == world || (!ground->velocity && !ground->avelocity)) &&
+		!ent->velocity && !ent->avelocity &&
+		ent->linkcount == ent->rest_linkcount &&
+		// live monsters move by stepping, and anything in liquid
+		// still needs its water checks
+		!((ent->svflags & SVF_MONSTER) && ent->health > 0) &&
+		ent->waterlevel == WATER_NONE && !(ent->flags & FL_INWATER);
+
+	if (!at_rest)
+	{
+		ent->rest_frames = 0;
+		ent->rest_linkcount = ent->linkcount;
+		return false;
+	}
+
+	if (ent->rest_frames < SV_SLEEP_FRAMES)
+	{
+		ent->rest_frames++;
+		return false;
+	}
+
+	return true;
+}
+
 /*
 ==================
 G_Impact
@@ -303,6 +500,10 @@ bool SV_Push(edict_t *pusher, vec3_t &move, vec3_t &amove)
 				check->absmax[0] <= mins[0] || check->absmax[1] <= mins[1] || check->absmax[2] <= mins[2])
 				continue;
 
+			// anything the pusher sweeps through has to re-check
+			// its surroundings, even if it isn't moved
+			SV_WakeEntity(check);
+
 			// see if the ent's bbox is inside the pusher's final position
 			if (!SV_TestEntityPosition(check))
 				continue;
@@ -739,7 +940,16 @@ void SV_Physics_Step(edict_t *ent)
 	float	   speed, newspeed, control;
 	float	   friction;
 	edict_t	*groundentity;
-	contents_t mask = G_GetClipMask(ent);
+	contents_t mask;
+
+	// nothing to simulate; just think
+	if (SV_CheckSleep(ent))
+	{
+		SV_RunThink(ent);
+		return;
+	}
+
+	mask = G_GetClipMask(ent);
 
 	// airborne monsters should always check for ground
 	if (!ent->groundentity)
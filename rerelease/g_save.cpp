@@ -414,6 +414,11 @@ struct save_type_deducer<gtime_t>
 	}
 };
 
+template<>
+struct save_type_deducer<think_time_t> : save_type_deducer<gtime_t>
+{
+};
+
 template<>
 struct save_type_deducer<spawnflags_t>
 {
@@ -1094,6 +1099,7 @@ SAVE_STRUCT_START
 	FIELD_LEVEL_STRING(style_off),
 
 	FIELD_AUTO(item),
+	FIELD_AUTO(item_respawn_time),
 	FIELD_AUTO(crosslevel_flags),
 
 	// moveinfo_t
@@ -2514,11 +2520,13 @@ void ReadLevelJson(const char *jsonString)
 	// free any dynamic memory allocated by loading the level
 	// base state
 	gi.FreeTags(TAG_LEVEL);
+	ED_ResetStringArena(0);
 
 	Json::Value json = parseJson(jsonString);
 
 	// wipe all the entities
 	memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
+	G_EdictHot_Clear();
 	globals.num_edicts = game.maxclients + 1;
 
 	// read level
@@ -2526,6 +2534,12 @@ void ReadLevelJson(const char *jsonString)
 	read_save_struct_json(json["level"], &level, &level_locals_t_savestruct);
 	json_pop_stack();
 
+	G_ThinkWheel_Clear();
+	M_NavPathQueue_Clear();
+	G_SpawnPoints_Invalidate();
+	G_TriggerCache_Clear();
+	CTFIDIndex_Clear();
+
 	// read entities
 	const Json::Value &entities = json["entities"];
 
@@ -2549,6 +2563,9 @@ void ReadLevelJson(const char *jsonString)
 		json_push_stack(fmt::format("entities[{}]", number));
 		read_save_struct_json(value, ent, &edict_t_savestruct);
 		json_pop_stack();
+		G_EdictHot_Sync(ent);
+		// nextthink was written raw
+		G_ThinkWheel_Schedule(ent);
 		gi.linkentity(ent);
 	}
 
@@ -2577,6 +2594,7 @@ void ReadLevelJson(const char *jsonString)
 	}
 
 	G_PrecacheInventoryItems();
+	G_Corpse_Rebuild();
 
 	// clear cached indices
 	cached_soundindex::reset_all();
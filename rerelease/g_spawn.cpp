@@ -437,6 +437,51 @@ static const std::initializer_list<spawn_t> spawns = {
 };
 // clang-format on
 
+/*
+===============
+ED_SpawnDispatch
+
+Every spawnable classname - items, spawn functions and the legacy
+aliases - sorted once so ED_CallSpawn can binary search it. Where a
+name appears more than once, the first one added wins, which keeps
+the old lookup order: aliases, then items, then spawns.
+===============
+*/
+struct spawn_dispatch_t
+{
+	std::string_view name;
+	gitem_t			*item;  // item spawn, or
+	const spawn_t	*spawn; // regular spawn function
+	bool			 alias;  // rename to item->classname
+};
+
+static const std::vector<spawn_dispatch_t> &ED_SpawnDispatch()
+{
+	static const std::vector<spawn_dispatch_t> dispatch = []() {
+		std::vector<spawn_dispatch_t> d;
+
+		// FIXME - PMM classnames hack
+		d.push_back({ "weapon_nailgun", GetItemByIndex(IT_WEAPON_ETF_RIFLE), nullptr, true });
+		d.push_back({ "ammo_nails", GetItemByIndex(IT_AMMO_FLECHETTES), nullptr, true });
+		d.push_back({ "weapon_heatbeam", GetItemByIndex(IT_WEAPON_PLASMABEAM), nullptr, true });
+		// pmm
+
+		for (gitem_t &item : itemlist)
+			if (item.classname)
+				d.push_back({ item.classname, &item, nullptr, false });
+
+		for (const spawn_t &s : spawns)
+			d.push_back({ s.name, nullptr, &s, false });
+
+		std::stable_sort(d.begin(), d.end(), [](const spawn_dispatch_t &a, const spawn_dispatch_t &b) { return a.name < b.name; });
+		d.erase(std::unique(d.begin(), d.end(), [](const spawn_dispatch_t &a, const spawn_dispatch_t &b) { return a.name == b.name; }), d.end());
+
+		return d;
+	}();
+
+	return dispatch;
+}
+
 /*
 ===============
 ED_CallSpawn
@@ -446,9 +491,6 @@ Finds the spawn function for the entity and calls it
 */
 void ED_CallSpawn(edict_t *ent)
 {
-	gitem_t *item;
-	int		 i;
-
 	if (!ent->classname)
 	{
 		gi.Com_Print("ED_CallSpawn: nullptr classname\n");
@@ -464,23 +506,21 @@ void ED_CallSpawn(edict_t *ent)
 
 	ent->sv.init = false;
 
-	// FIXME - PMM classnames hack
-	if (!strcmp(ent->classname, "weapon_nailgun"))
-		ent->classname = GetItemByIndex(IT_WEAPON_ETF_RIFLE)->classname;
-	if (!strcmp(ent->classname, "ammo_nails"))
-		ent->classname = GetItemByIndex(IT_AMMO_FLECHETTES)->classname;
-	if (!strcmp(ent->classname, "weapon_heatbeam"))
-		ent->classname = GetItemByIndex(IT_WEAPON_PLASMABEAM)->classname;
-	// pmm
+	const std::vector<spawn_dispatch_t> &dispatch = ED_SpawnDispatch();
+	std::string_view					 classname = ent->classname;
+
+	auto found = std::lower_bound(dispatch.begin(), dispatch.end(), classname,
+		[](const spawn_dispatch_t &d, const std::string_view &name) { return d.name < name; });
 
-	// check item spawn functions
-	for (i = 0, item = itemlist; i < IT_TOTAL; i++, item++)
+	if (found != dispatch.end() && found->name == classname)
 	{
-		if (!item->classname)
-			continue;
-		if (!strcmp(item->classname, ent->classname))
+		if (found->item)
 		{
-			// found it
+			gitem_t *item = found->item;
+
+			if (found->alias)
+				ent->classname = item->classname;
+
 			// before spawning, pick random item replacement
 			if (g_dm_random_items->integer)
 			{
@@ -497,26 +537,66 @@ void ED_CallSpawn(edict_t *ent)
 			SpawnItem(ent, item);
 			return;
 		}
-	}
 
-	// check normal spawn functions
-	for (auto &s : spawns)
-	{
-		if (!strcmp(s.name, ent->classname))
-		{ // found it
-			s.spawn(ent);
+		const spawn_t &s = *found->spawn;
 
-			// Paril: swap classname with stored constant if we didn't change it
-			if (strcmp(ent->classname, s.name) == 0)
-				ent->classname = s.name;
-			return;
-		}
+		s.spawn(ent);
+
+		// Paril: swap classname with stored constant if we didn't change it
+		if (strcmp(ent->classname, s.name) == 0)
+			ent->classname = s.name;
+		return;
 	}
 
 	gi.Com_PrintFmt("{} doesn't have a spawn function\n", *ent);
 	G_FreeEdict(ent);
 }
 
+/*
+=============
+ED string arena
+
+Entity strings live as long as the level, so rather than one
+allocation each they're carved out of large TAG_LEVEL blocks. The
+first block is sized from the entity lump, which bounds everything
+parsed out of it; anything later (spawn commands and the like)
+gets small overflow blocks.
+=============
+*/
+constexpr size_t ED_STRING_BLOCK_SIZE = 4096;
+
+static struct
+{
+	char  *cursor;
+	size_t remaining;
+} ed_strings;
+
+void ED_ResetStringArena(size_t reserve)
+{
+	ed_strings = {};
+
+	if (reserve)
+	{
+		ed_strings.cursor = (char *) gi.TagMalloc(reserve, TAG_LEVEL);
+		ed_strings.remaining = reserve;
+	}
+}
+
+static char *ED_AllocString(size_t size)
+{
+	if (size > ed_strings.remaining)
+	{
+		size_t block = max(size, ED_STRING_BLOCK_SIZE);
+		ed_strings.cursor = (char *) gi.TagMalloc(block, TAG_LEVEL);
+		ed_strings.remaining = block;
+	}
+
+	char *p = ed_strings.cursor;
+	ed_strings.cursor += size;
+	ed_strings.remaining -= size;
+	return p;
+}
+
 /*
 =============
 ED_NewString
@@ -530,7 +610,7 @@ char *ED_NewString(const char *string)
 
 	l = strlen(string) + 1;
 
-	newb = (char *) gi.TagMalloc(l, TAG_LEVEL);
+	newb = ED_AllocString(l);
 
 	new_p = newb;
 
@@ -850,6 +930,95 @@ static const std::initializer_list<temp_field_t> temp_fields = {
 };
 // clang-format on
 
+/*
+===============
+ED_FindKey
+
+Spawn keys from both field lists in one open-addressed table,
+hashed case-insensitively, so a key costs one hash and usually
+one compare. Each key also gets its bit in keys_specified.
+temp_fields are added first so they shadow entity_fields, as the
+old linear search did.
+===============
+*/
+struct ed_key_t
+{
+	const char		   *name;
+	const temp_field_t *temp;  // one of these is set
+	const field_t	   *field;
+	uint32_t			index; // bit in spawn_temp_t::keys_specified
+	bool				enables_bmodel_anim;
+};
+
+constexpr size_t ED_KEY_TABLE_SIZE = 512; // power of two, well over the key count
+
+static uint32_t ED_HashKey(const char *key)
+{
+	uint32_t h = 2166136261u;
+
+	for (; *key; key++)
+		h = (h ^ (uint8_t) tolower((uint8_t) *key)) * 16777619u;
+
+	return h;
+}
+
+static const ed_key_t *ED_FindKey(const char *key)
+{
+	static const std::vector<ed_key_t> table = []() {
+		std::vector<ed_key_t> t(ED_KEY_TABLE_SIZE);
+		uint32_t			  count = 0;
+
+		auto add = [&](ed_key_t key) {
+			for (size_t i = ED_HashKey(key.name);; i++)
+			{
+				ed_key_t &slot = t[i & (ED_KEY_TABLE_SIZE - 1)];
+
+				if (!slot.name)
+				{
+					if (count == MAX_SPAWN_KEYS)
+						gi.Com_Error("ED_FindKey: too many spawn keys; raise MAX_SPAWN_KEYS");
+
+					key.index = count++;
+					slot = key;
+					return;
+				}
+				else if (!Q_strcasecmp(slot.name, key.name))
+					return;
+			}
+		};
+
+		for (auto &f : temp_fields)
+			add({ f.name, &f, nullptr });
+
+		for (auto &f : entity_fields)
+			add({ f.name, nullptr, &f, 0, !strcmp(f.name, "bmodel_anim_start") || !strcmp(f.name, "bmodel_anim_end") });
+
+		return t;
+	}();
+
+	for (size_t i = ED_HashKey(key);; i++)
+	{
+		const ed_key_t &slot = table[i & (ED_KEY_TABLE_SIZE - 1)];
+
+		if (!slot.name)
+			return nullptr;
+		else if (!Q_strcasecmp(slot.name, key))
+			return &slot;
+	}
+}
+
+bool spawn_temp_t::was_key_specified(const char *key) const
+{
+	const ed_key_t *k = ED_FindKey(key);
+	return k && keys_specified[k->index];
+}
+
+void spawn_temp_t::mark_key_specified(const char *key)
+{
+	if (const ed_key_t *k = ED_FindKey(key))
+		keys_specified[k->index] = true;
+}
+
 /*
 ===============
 ED_ParseField
@@ -860,79 +1029,179 @@ in an edict
 */
 void ED_ParseField(const char *key, const char *value, edict_t *ent)
 {
-	// check st first
-	for (auto &f : temp_fields)
+	const ed_key_t *k = ED_FindKey(key);
+
+	if (!k)
 	{
-		if (Q_strcasecmp(f.name, key))
-			continue;
+		gi.Com_PrintFmt("{} is not a valid field\n", key);
+		return;
+	}
 
-		st.keys_specified.emplace(f.name);
+	st.keys_specified[k->index] = true;
 
+	// check st first
+	if (k->temp)
+	{
 		// found it
-		if (f.load_func)
-			f.load_func(&st, value);
-		
+		if (k->temp->load_func)
+			k->temp->load_func(&st, value);
+
 		return;
 	}
 
 	// now entity
-	for (auto &f : entity_fields)
+
+	// [Paril-KEX]
+	if (k->enables_bmodel_anim)
+		ent->bmodel_anim.enabled = true;
+
+	// found it
+	if (k->field->load_func)
+		k->field->load_func(ent, value);
+}
+
+/*
+====================
+ENTITY LUMP CACHE
+
+The entity string is tokenized once into key/value pairs, and the
+result is kept for the last few maps by checksum, so restarts and map
+rotations skip straight to spawning. Only the tokens are cached;
+everything that depends on cvars or spawn results (inhibition, teams,
+hint paths, trainer items) is still worked out on every load.
+====================
+*/
+constexpr size_t ED_LUMP_CACHE_SIZE = 4;
+
+struct ed_lump_pair_t
+{
+	uint32_t key, value; // offsets into ed_lump_t::strings
+};
+
+struct ed_lump_t
+{
+	uint64_t					checksum;
+	size_t						length;
+	std::string					strings;	  // every key and value, NUL terminated
+	std::vector<ed_lump_pair_t> pairs;
+	std::vector<uint32_t>		entity_start; // first pair of each entity, plus an end marker
+
+	size_t num_entities() const { return entity_start.size() - 1; }
+
+	uint32_t add_string(const char *str)
 	{
-		if (Q_strcasecmp(f.name, key))
-			continue;
+		uint32_t offset = (uint32_t) strings.size();
+		strings.append(str);
+		strings.push_back('\0');
+		return offset;
+	}
+};
 
-		st.keys_specified.emplace(f.name);
+static std::vector<ed_lump_t> ed_lump_cache; // most recently used first
 
-		// [Paril-KEX]
-		if (!strcmp(f.name, "bmodel_anim_start") || !strcmp(f.name, "bmodel_anim_end"))
-			ent->bmodel_anim.enabled = true;
+/*
+====================
+ED_TokenizeLump
 
-		// found it
-		if (f.load_func)
-			f.load_func(ent, value);
+Same parsing, and same errors, as ED_LoadFromFile/ED_ParseEdict
+did while spawning.
+====================
+*/
+static void ED_TokenizeLump(const char *data, ed_lump_t &lump)
+{
+	char		keyname[256];
+	const char *com_token;
 
-		return;
+	while (1)
+	{
+		// parse the opening brace
+		com_token = COM_Parse(&data);
+		if (!data)
+			break;
+		if (com_token[0] != '{')
+			gi.Com_ErrorFmt("ED_LoadFromFile: found \"{}\" when expecting {{", com_token);
+
+		lump.entity_start.push_back((uint32_t) lump.pairs.size());
+
+		// go through all the dictionary pairs
+		while (1)
+		{
+			// parse key
+			com_token = COM_Parse(&data);
+			if (com_token[0] == '}')
+				break;
+			if (!data)
+				gi.Com_Error("ED_ParseEntity: EOF without closing brace");
+
+			Q_strlcpy(keyname, com_token, sizeof(keyname));
+
+			// parse value
+			com_token = COM_Parse(&data);
+			if (!data)
+				gi.Com_Error("ED_ParseEntity: EOF without closing brace");
+
+			if (com_token[0] == '}')
+				gi.Com_Error("ED_ParseEntity: closing brace without data");
+
+			uint32_t key = lump.add_string(keyname);
+			lump.pairs.push_back({ key, lump.add_string(com_token) });
+		}
 	}
 
-	gi.Com_PrintFmt("{} is not a valid field\n", key);
+	lump.entity_start.push_back((uint32_t) lump.pairs.size());
+}
+
+static const ed_lump_t &ED_CacheEntityLump(const char *entities)
+{
+	size_t	 length = strlen(entities);
+	uint64_t checksum = 14695981039346656037ull;
+
+	for (size_t i = 0; i < length; i++)
+		checksum = (checksum ^ (uint8_t) entities[i]) * 1099511628211ull;
+
+	for (auto it = ed_lump_cache.begin(); it != ed_lump_cache.end(); ++it)
+	{
+		if (it->checksum == checksum && it->length == length)
+		{
+			std::rotate(ed_lump_cache.begin(), it, it + 1);
+			return ed_lump_cache.front();
+		}
+	}
+
+	ed_lump_t lump;
+	lump.checksum = checksum;
+	lump.length = length;
+	lump.strings.reserve(length);
+	ED_TokenizeLump(entities, lump);
+
+	ed_lump_cache.insert(ed_lump_cache.begin(), std::move(lump));
+
+	if (ed_lump_cache.size() > ED_LUMP_CACHE_SIZE)
+		ed_lump_cache.pop_back();
+
+	return ed_lump_cache.front();
 }
 
 /*
 ====================
 ED_ParseEdict
 
-Parses an edict out of the given string, returning the new position
+Applies one entity's parsed pairs to the given edict.
 ed should be a properly initialized empty edict.
 ====================
 */
-const char *ED_ParseEdict(const char *data, edict_t *ent)
+void ED_ParseEdict(const ed_lump_t &lump, size_t index, edict_t *ent)
 {
-	bool  init;
-	char  keyname[256];
-	const char *com_token;
+	bool init;
 
 	init = false;
 	st = {};
 	
 	// go through all the dictionary pairs
-	while (1)
+	for (uint32_t i = lump.entity_start[index]; i < lump.entity_start[index + 1]; i++)
 	{
-		// parse key
-		com_token = COM_Parse(&data);
-		if (com_token[0] == '}')
-			break;
-		if (!data)
-			gi.Com_Error("ED_ParseEntity: EOF without closing brace");
-
-		Q_strlcpy(keyname, com_token, sizeof(keyname));
-
-		// parse value
-		com_token = COM_Parse(&data);
-		if (!data)
-			gi.Com_Error("ED_ParseEntity: EOF without closing brace");
-
-		if (com_token[0] == '}')
-			gi.Com_Error("ED_ParseEntity: closing brace without data");
+		const char *keyname = lump.strings.c_str() + lump.pairs[i].key;
+		const char *value = lump.strings.c_str() + lump.pairs[i].value;
 
 		init = true;
 
@@ -942,18 +1211,16 @@ const char *ED_ParseEdict(const char *data, edict_t *ent)
 		{
 			// [Sam-KEX] Hack for setting RGBA for shadow-casting lights
 			if(!strcmp(keyname, "_color"))
-				ent->s.skinnum = ED_LoadColor(com_token);
+				ent->s.skinnum = ED_LoadColor(value);
 
 			continue;
 		}
 
-		ED_ParseField(keyname, com_token, ent);
+		ED_ParseField(keyname, value, ent);
 	}
 
 	if (!init)
 		memset(ent, 0, sizeof(*ent));
-
-	return data;
 }
 
 /*
@@ -967,12 +1234,21 @@ All but the last will have the teamchain field set to the next one
 ================
 */
 
+// every in-use entity with a team, by team name, in entity order
+struct team_members_t
+{
+	edict_t				 *tail; // end of the chain G_FindTeams is building
+	std::vector<edict_t *> members;
+};
+
+using team_map_t = std::unordered_map<std::string_view, team_members_t>;
+
 // adjusts teams so that trains that move their children
 // are in the front of the team
-void G_FixTeams()
+void G_FixTeams(team_map_t &teams)
 {
-	edict_t *e, *e2, *chain;
-	uint32_t i, j;
+	edict_t *e, *chain;
+	uint32_t i;
 	uint32_t c;
 
 	c = 0;
@@ -992,25 +1268,19 @@ void G_FixTeams()
 				e->flags &= ~FL_TEAMSLAVE;
 				e->flags |= FL_TEAMMASTER;
 				c++;
-				for (j = 1, e2 = g_edicts + j; j < globals.num_edicts; j++, e2++)
+				for (edict_t *e2 : teams[e->team].members)
 				{
 					if (e2 == e)
 						continue;
-					if (!e2->inuse)
-						continue;
-					if (!e2->team)
-						continue;
-					if (!strcmp(e->team, e2->team))
-					{
-						chain->teamchain = e2;
-						e2->teammaster = e;
-						e2->teamchain = nullptr;
-						chain = e2;
-						e2->flags |= FL_TEAMSLAVE;
-						e2->flags &= ~FL_TEAMMASTER;
-						e2->movetype = MOVETYPE_PUSH;
-						e2->speed = e->speed;
-					}
+
+					chain->teamchain = e2;
+					e2->teammaster = e;
+					e2->teamchain = nullptr;
+					chain = e2;
+					e2->flags |= FL_TEAMSLAVE;
+					e2->flags &= ~FL_TEAMMASTER;
+					e2->movetype = MOVETYPE_PUSH;
+					e2->speed = e->speed;
 				}
 			}
 		}
@@ -1021,10 +1291,14 @@ void G_FixTeams()
 
 void G_FindTeams()
 {
-	edict_t *e, *e2, *chain;
-	uint32_t i, j;
+	edict_t *e;
+	uint32_t i;
 	uint32_t c, c2;
 
+	// one pass: the first free entity of each team becomes its master,
+	// and later ones are appended to that team's chain in entity order
+	team_map_t teams;
+
 	c = 0;
 	c2 = 0;
 	for (i = 1, e = g_edicts + i; i < globals.num_edicts; i++, e++)
@@ -1033,34 +1307,33 @@ void G_FindTeams()
 			continue;
 		if (!e->team)
 			continue;
+
+		team_members_t &team = teams[e->team];
+		team.members.push_back(e);
+
 		if (e->flags & FL_TEAMSLAVE)
 			continue;
-		chain = e;
-		e->teammaster = e;
-		e->flags |= FL_TEAMMASTER;
-		c++;
+
 		c2++;
-		for (j = i + 1, e2 = e + 1; j < globals.num_edicts; j++, e2++)
+
+		if (!team.tail)
 		{
-			if (!e2->inuse)
-				continue;
-			if (!e2->team)
-				continue;
-			if (e2->flags & FL_TEAMSLAVE)
-				continue;
-			if (!strcmp(e->team, e2->team))
-			{
-				c2++;
-				chain->teamchain = e2;
-				e2->teammaster = e;
-				chain = e2;
-				e2->flags |= FL_TEAMSLAVE;
-			}
+			e->teammaster = e;
+			e->flags |= FL_TEAMMASTER;
+			c++;
 		}
+		else
+		{
+			team.tail->teamchain = e;
+			e->teammaster = team.tail->teammaster;
+			e->flags |= FL_TEAMSLAVE;
+		}
+
+		team.tail = e;
 	}
 
 	// ROGUE
-	G_FixTeams();
+	G_FixTeams(teams);
 	// ROGUE
 
 	gi.Com_PrintFmt("{} teams with {} entities\n", c, c2);
@@ -1151,7 +1424,6 @@ void SpawnEntities(const char *mapname, const char *entities, const char *spawnp
 
 	edict_t *ent;
 	int		 inhibit;
-	const char	 *com_token;
 
 	int skill_level = clamp(skill->integer, 0, 3);
 	if (skill->integer != skill_level)
@@ -1160,9 +1432,18 @@ void SpawnEntities(const char *mapname, const char *entities, const char *spawnp
 	SaveClientData();
 
 	gi.FreeTags(TAG_LEVEL);
+	ED_ResetStringArena(strlen(entities) + 1);
 
 	memset(&level, 0, sizeof(level));
 	memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
+	G_EdictHot_Clear();
+	G_ThinkWheel_Clear();
+	M_NavPathQueue_Clear();
+	G_TempEntity_Clear();
+	G_Corpse_Clear();
+	G_SpawnPoints_Invalidate();
+	G_TriggerCache_Clear();
+	CTFIDIndex_Clear();
 
 	// all other flags are not important atm
 	globals.server_flags &= SERVER_FLAG_LOADING;
@@ -1196,20 +1477,15 @@ void SpawnEntities(const char *mapname, const char *entities, const char *spawnp
 	InitBodyQue();
 
 	// parse ents
-	while (1)
-	{
-		// parse the opening brace
-		com_token = COM_Parse(&entities);
-		if (!entities)
-			break;
-		if (com_token[0] != '{')
-			gi.Com_ErrorFmt("ED_LoadFromFile: found \"{}\" when expecting {{", com_token);
+	const ed_lump_t &lump = ED_CacheEntityLump(entities);
 
+	for (size_t i = 0; i < lump.num_entities(); i++)
+	{
 		if (!ent)
 			ent = g_edicts;
 		else
 			ent = G_Spawn();
-		entities = ED_ParseEdict(entities, ent);
+		ED_ParseEdict(lump, i, ent);
 
 		// remove things (except the world) from different skill levels or deathmatch
 		if (ent != g_edicts)
@@ -442,6 +442,7 @@ void SP_turret_driver(edict_t *self)
 	level.total_monsters++;
 
 	self->svflags |= SVF_MONSTER;
+	G_EdictHot_Sync(self);
 	self->takedamage = true;
 	self->use = monster_use;
 	self->clipmask = MASK_MONSTERSOLID;
@@ -66,6 +66,47 @@ edict_t *findradius(edict_t *from, const vec3_t &org, float rad)
 	return nullptr;
 }
 
+struct findradius_filter_t
+{
+	vec3_t org;
+	float  rad;
+};
+
+static BoxEdictsResult_t G_FindRadiusLinked_BoxFilter(edict_t *hit, void *data)
+{
+	const findradius_filter_t *filter = (const findradius_filter_t *) data;
+
+	if (!hit->inuse || hit->solid == SOLID_NOT)
+		return BoxEdictsResult_t::Skip;
+	if ((filter->org - (hit->s.origin + (hit->mins + hit->maxs) * 0.5f)).length() > filter->rad)
+		return BoxEdictsResult_t::Skip;
+
+	return BoxEdictsResult_t::Keep;
+}
+
+/*
+=================
+G_FindRadiusLinked
+
+Finds the same entities as a findradius loop, but only looks at linked
+ones, which it gets from the engine's area grid rather than by walking
+every edict. The list is in entity order, like findradius.
+=================
+*/
+size_t G_FindRadiusLinked(const vec3_t &org, float rad, edict_t **list, size_t maxcount)
+{
+	findradius_filter_t filter { org, rad };
+	vec3_t				range { rad, rad, rad };
+	size_t				num;
+
+	num = min(gi.BoxEdicts(org - range, org + range, list, maxcount, AREA_SOLID, G_FindRadiusLinked_BoxFilter, &filter), maxcount);
+	num += min(gi.BoxEdicts(org - range, org + range, list + num, maxcount - num, AREA_TRIGGERS, G_FindRadiusLinked_BoxFilter, &filter), maxcount - num);
+
+	std::sort(list, list + num);
+
+	return num;
+}
+
 /*
 =============
 G_PickTarget
@@ -331,6 +372,8 @@ void G_InitEdict(edict_t *e)
 	e->gravityVector[1] = 0.0;
 	e->gravityVector[2] = -1.0;
 	// PGM
+
+	G_EdictHot_Sync(e);
 }
 
 /*
@@ -393,6 +436,7 @@ THINK(G_FreeEdict) (edict_t *ed) -> void
 	}
 
 	gi.Bot_UnRegisterEdict( ed );
+	G_Corpse_Remove(ed);
 
 	int32_t id = ed->spawn_count + 1;
 	memset(ed, 0, sizeof(*ed));
@@ -402,14 +446,138 @@ THINK(G_FreeEdict) (edict_t *ed) -> void
 	ed->inuse = false;
 	ed->spawn_count = id;
 	ed->sv.init = false;
+
+	G_EdictHot_Sync(ed);
+}
+
+/*
+=================
+G_EdictHot
+
+Dense mirror of the per-edict bits the frame loop
+needs; see edict_hot_t.
+=================
+*/
+edict_hot_t g_edict_hot;
+
+void G_EdictHot_Init()
+{
+	g_edict_hot.inuse.resize(game.maxentities);
+	g_edict_hot.monster.resize(game.maxentities);
+	g_edict_hot.think_due.resize(game.maxentities);
+	g_edict_hot.projectile.resize(game.maxentities);
+	g_edict_hot.trigger.resize(game.maxentities);
 }
 
-BoxEdictsResult_t G_TouchTriggers_BoxFilter(edict_t *hit, void *)
+void G_EdictHot_Clear()
 {
-	if (!hit->touch)
-		return BoxEdictsResult_t::Skip;
+	g_edict_hot.inuse.clear();
+	g_edict_hot.monster.clear();
+	g_edict_hot.think_due.clear();
+	g_edict_hot.projectile.clear();
+	g_edict_hot.trigger.clear();
+}
 
-	return BoxEdictsResult_t::Keep;
+void G_EdictHot_Sync(edict_t *ent)
+{
+	uint32_t i = ent - g_edicts;
+
+	// clients and the world are always walked directly
+	g_edict_hot.inuse.set(i, ent->inuse && i > game.maxclients);
+	g_edict_hot.monster.set(i, ent->inuse && (ent->svflags & SVF_MONSTER));
+	g_edict_hot.projectile.set(i, ent->inuse && (ent->svflags & SVF_PROJECTILE));
+}
+
+/*
+=================
+TRIGGER CACHE
+
+Each entity that touches triggers remembers which ones it overlapped,
+along with its bounds and the trigger link generation at the time.
+The generation moves whenever a trigger is linked or unlinked, so an
+entity that hasn't moved, in a world whose triggers haven't changed,
+reuses its last set instead of asking the engine again. When the set
+is rebuilt, it's diffed against the old one for enter/exit events.
+=================
+*/
+struct trigger_touch_cache_t
+{
+	int32_t				   spawn_count;
+	uint32_t			   generation; // 0 = never filled
+	vec3_t				   absmin, absmax;
+	std::vector<edict_t *> touching;
+};
+
+static struct
+{
+	uint32_t						   generation = 1;
+	std::vector<trigger_touch_cache_t> ents;
+} trigger_cache;
+
+void G_TriggerCache_Clear()
+{
+	trigger_cache.generation++;
+	trigger_cache.ents.clear();
+}
+
+void G_TriggerLinkChanged(edict_t *ent)
+{
+	uint32_t i = ent - g_edicts;
+
+	if (i >= game.maxentities || g_edict_hot.trigger.words.empty())
+		return;
+
+	bool is_trigger = ent->linked && ent->solid == SOLID_TRIGGER;
+
+	if (!is_trigger && !g_edict_hot.trigger.test(i))
+		return;
+
+	g_edict_hot.trigger.set(i, is_trigger);
+	trigger_cache.generation++;
+}
+
+static void G_TriggerCache_Event(edict_t *ent, edict_t *trigger, bool entered)
+{
+	if (!g_debug_triggers->integer || !ent->client)
+		return;
+
+	gi.Com_PrintFmt("{}: {} {} at {}\n", *ent, entered ? "entered" : "left", *trigger, level.time.milliseconds());
+}
+
+// the triggers overlapping ent's bounds
+static const std::vector<edict_t *> &G_TriggersTouching(edict_t *ent)
+{
+	static edict_t *list[MAX_EDICTS];
+
+	if (trigger_cache.ents.empty())
+		trigger_cache.ents.resize(game.maxentities);
+
+	trigger_touch_cache_t &cache = trigger_cache.ents[ent->s.number];
+
+	if (cache.generation == trigger_cache.generation && cache.spawn_count == ent->spawn_count &&
+		cache.absmin == ent->absmin && cache.absmax == ent->absmax)
+		return cache.touching;
+
+	size_t num = min(gi.BoxEdicts(ent->absmin, ent->absmax, list, MAX_EDICTS, AREA_TRIGGERS, nullptr, nullptr), (size_t) MAX_EDICTS);
+
+	if (cache.spawn_count != ent->spawn_count)
+		cache.touching.clear();
+
+	for (edict_t *old : cache.touching)
+		if (std::find(list, list + num, old) == list + num)
+			G_TriggerCache_Event(ent, old, false);
+
+	for (size_t i = 0; i < num; i++)
+		if (std::find(cache.touching.begin(), cache.touching.end(), list[i]) == cache.touching.end())
+			G_TriggerCache_Event(ent, list[i], true);
+
+	cache.spawn_count = ent->spawn_count;
+	cache.generation = trigger_cache.generation;
+	cache.absmin = ent->absmin;
+	cache.absmax = ent->absmax;
+	cache.touching.assign(list, list + num);
+
+	return cache.touching;
 }
 
 /*
@@ -428,7 +596,11 @@ void G_TouchTriggers(edict_t *ent)
 	if ((ent->client || (ent->svflags & SVF_MONSTER)) && (ent->health <= 0))
 		return;
 
-	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch, MAX_EDICTS, AREA_TRIGGERS, G_TouchTriggers_BoxFilter, nullptr);
+	// copied out, since touching can relink us
+	const std::vector<edict_t *> &touching = G_TriggersTouching(ent);
+
+	num = (int) touching.size();
+	std::copy(touching.begin(), touching.end(), touch);
 
 	// be careful, it is possible to have an entity in this
 	// list removed before we get to it (killtriggered)
@@ -443,6 +615,21 @@ void G_TouchTriggers(edict_t *ent)
 	}
 }
 
+// true if any live projectile overlaps the given box
+static bool G_ProjectileInBox(const vec3_t &mins, const vec3_t &maxs)
+{
+	for (uint32_t i = g_edict_hot.projectile.next(1, globals.num_edicts); i < globals.num_edicts;
+		 i = g_edict_hot.projectile.next(i + 1, globals.num_edicts))
+	{
+		const edict_t *e = &g_edicts[i];
+
+		if (e->inuse && (e->svflags & SVF_PROJECTILE) && boxes_intersect(e->absmin, e->absmax, mins, maxs))
+			return true;
+	}
+
+	return false;
+}
+
 // [Paril-KEX] scan for projectiles between our movement positions
 // to see if we need to collide against them
 void G_TouchProjectiles(edict_t *ent, vec3_t previous_origin)
@@ -455,6 +642,19 @@ void G_TouchProjectiles(edict_t *ent, vec3_t previous_origin)
 	// a bit ugly, but we'll store projectiles we are ignoring here.
 	static std::vector<skipped_projectile> skipped;
 
+	// nothing for the trace to find if no projectile
+	// is anywhere near the swept box
+	vec3_t sweep_mins, sweep_maxs;
+
+	for (int i = 0; i < 3; i++)
+	{
+		sweep_mins[i] = min(previous_origin[i], ent->s.origin[i]) + ent->mins[i] - 1;
+		sweep_maxs[i] = max(previous_origin[i], ent->s.origin[i]) + ent->maxs[i] + 1;
+	}
+
+	if (!G_ProjectileInBox(sweep_mins, sweep_maxs))
+		return;
+
 	while (true)
 	{
 		trace_t tr = gi.trace(previous_origin, ent->mins, ent->maxs, ent->s.origin, ent, ent->clipmask | CONTENTS_PROJECTILE);
@@ -560,3 +760,123 @@ bool KillBox(edict_t *ent, bool from_spawning, mod_id_t mod, bool bsp_clipping)
 
 	return true; // all clear
 }
+
+/*
+===============================================================================
+
+TEMP ENTITY COLLECTOR
+
+Impact and beam temp entities are queued through the frame instead of
+being multicast on the spot. Repeats of the same effect on the same spot
+are dropped as they come in, and at the end of the frame nearby effects
+sharing a multicast type are written back to back and sent with one
+multicast from the first one's origin. Only effects in the first one's
+PVS (or PHS), close enough to share its view, are merged into it; the
+rest go out on their own, as before.
+
+===============================================================================
+*/
+
+constexpr float TE_DUPLICATE_DIST = 8.f;
+constexpr float TE_CLUSTER_DIST = 128.f;
+constexpr size_t TE_CLUSTER_MAX = 16;
+
+struct queued_temp_entity_t
+{
+	temp_event_t type;
+	bool		 beam; // b is an end point instead of a direction
+	multicast_t	 to;
+	vec3_t		 a, b;
+};
+
+static std::vector<queued_temp_entity_t> queued_temp_entities;
+
+static void G_QueueTempEntity(const queued_temp_entity_t &te)
+{
+	for (const queued_temp_entity_t &other : queued_temp_entities)
+	{
+		if (other.type != te.type || other.beam != te.beam || other.to != te.to)
+			continue;
+		else if ((other.a - te.a).lengthSquared() > TE_DUPLICATE_DIST * TE_DUPLICATE_DIST)
+			continue;
+		else if (te.beam && (other.b - te.b).lengthSquared() > TE_DUPLICATE_DIST * TE_DUPLICATE_DIST)
+			continue;
+
+		return;
+	}
+
+	queued_temp_entities.push_back(te);
+}
+
+// type + position + direction
+void G_TempEntity_Impact(temp_event_t type, const vec3_t &origin, const vec3_t &dir, multicast_t to)
+{
+	G_QueueTempEntity({ type, false, to, origin, dir });
+}
+
+// type + start + end
+void G_TempEntity_Beam(temp_event_t type, const vec3_t &start, const vec3_t &end, multicast_t to)
+{
+	G_QueueTempEntity({ type, true, to, start, end });
+}
+
+void G_TempEntity_Clear()
+{
+	queued_temp_entities.clear();
+}
+
+static void G_TempEntity_Write(const queued_temp_entity_t &te)
+{
+	gi.WriteByte(svc_temp_entity);
+	gi.WriteByte(te.type);
+	gi.WritePosition(te.a);
+	if (te.beam)
+		gi.WritePosition(te.b);
+	else
+		gi.WriteDir(te.b);
+}
+
+/*
+=================
+G_TempEntity_Flush
+
+Send everything queued this frame; called from ClientEndServerFrames.
+=================
+*/
+void G_TempEntity_Flush()
+{
+	static std::vector<bool> sent;
+
+	sent.assign(queued_temp_entities.size(), false);
+
+	for (size_t i = 0; i < queued_temp_entities.size(); i++)
+	{
+		if (sent[i])
+			continue;
+
+		const queued_temp_entity_t &seed = queued_temp_entities[i];
+		size_t clustered = 0;
+
+		for (size_t j = i; j < queued_temp_entities.size() && clustered < TE_CLUSTER_MAX; j++)
+		{
+			const queued_temp_entity_t &te = queued_temp_entities[j];
+
+			if (sent[j] || te.to != seed.to || (te.a - seed.a).lengthSquared() > TE_CLUSTER_DIST * TE_CLUSTER_DIST)
+				continue;
+			// only merge what the seed's multicast would reach
+			else if (j != i && seed.to == MULTICAST_PVS && !gi.inPVS(seed.a, te.a, false))
+				continue;
+			else if (j != i && seed.to == MULTICAST_PHS && !gi.inPHS(seed.a, te.a, false))
+				continue;
+
+			G_TempEntity_Write(te);
+
+			sent[j] = true;
+			clustered++;
+		}
+
+		gi.multicast(seed.a, seed.to, false);
+	}
+
+	queued_temp_entities.clear();
+}
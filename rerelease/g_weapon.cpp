@@ -94,7 +94,7 @@ void pierce_trace(const vec3_t &start, const vec3_t &end, edict_t *ignore, pierc
 
 	while (--loop_count)
 	{
-		pierce.tr = gi.traceline(start, own_end, ignore, mask);
+		pierce.tr = G_LagTraceLine(start, own_end, ignore, mask);
 
 		// didn't hit anything, so we're done
 		if (!pierce.tr.ent || pierce.tr.fraction == 1.0f)
@@ -110,6 +110,36 @@ void pierce_trace(const vec3_t &start, const vec3_t &end, edict_t *ignore, pierc
 	gi.Com_Print("runaway pierce_trace\n");
 }
 
+// wall impacts collected from every pellet of one shotgun blast,
+// sent together once all pellets have been traced
+struct fire_lead_batch_t
+{
+	static constexpr size_t MAX_IMPACTS = 6;
+	static constexpr float	IMPACT_MERGE_DIST = 24.f;
+
+	struct impact_t
+	{
+		vec3_t point, normal;
+	};
+
+	std::array<impact_t, MAX_IMPACTS> impacts;
+	size_t num_impacts = 0;
+
+	// puffs close to one we already have are folded into it,
+	// and past the limit they're dropped
+	void add_impact(const vec3_t &point, const vec3_t &normal)
+	{
+		for (size_t i = 0; i < num_impacts; i++)
+			if ((impacts[i].point - point).lengthSquared() < IMPACT_MERGE_DIST * IMPACT_MERGE_DIST)
+				return;
+
+		if (num_impacts == MAX_IMPACTS)
+			return;
+
+		impacts[num_impacts++] = { point, normal };
+	}
+};
+
 struct fire_lead_pierce_t : pierce_args_t
 {
 	edict_t		*self;
@@ -125,6 +155,7 @@ struct fire_lead_pierce_t : pierce_args_t
 	bool	     water = false;
 	vec3_t	     water_start = {};
 	edict_t	    *chain = nullptr;
+	fire_lead_batch_t *batch = nullptr;
 
 	inline fire_lead_pierce_t(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick, int hspread, int vspread, mod_t mod, int te_impact, contents_t mask) :
 		pierce_args_t(),
@@ -221,11 +252,13 @@ struct fire_lead_pierce_t : pierce_args_t
 			// don't mark the sky
 			if (te_impact != -1 && !(tr.surface && ((tr.surface->flags & SURF_SKY) || strncmp(tr.surface->name, "sky", 3) == 0)))
 			{
-				gi.WriteByte(svc_temp_entity);
-				gi.WriteByte(te_impact);
-				gi.WritePosition(tr.endpos);
-				gi.WriteDir(tr.plane.normal);
-				gi.multicast(tr.endpos, MULTICAST_PVS, false);
+				if (batch)
+				{
+					batch->add_impact(tr.endpos, tr.plane.normal);
+					return false;
+				}
+
+				G_TempEntity_Impact((temp_event_t) te_impact, tr.endpos, tr.plane.normal);
 
 				if (self->client)
 					PlayerNoise(self, tr.endpos, PNOISE_IMPACT);
@@ -238,6 +271,32 @@ struct fire_lead_pierce_t : pierce_args_t
 	}
 };
 
+// if went through water, determine where the end is and make a bubble trail
+static void fire_lead_bubbles(fire_lead_pierce_t &args)
+{
+	if (!args.water || args.te_impact == -1)
+		return;
+
+	vec3_t pos, dir;
+
+	dir = args.tr.endpos - args.water_start;
+	dir.normalize();
+	pos = args.tr.endpos + (dir * -2);
+	if (gi.pointcontents(pos) & MASK_WATER)
+		args.tr.endpos = pos;
+	else
+		args.tr = gi.traceline(pos, args.water_start, args.tr.ent != world ? args.tr.ent : nullptr, MASK_WATER);
+
+	pos = args.water_start + args.tr.endpos;
+	pos *= 0.5f;
+
+	gi.WriteByte(svc_temp_entity);
+	gi.WriteByte(TE_BUBBLETRAIL);
+	gi.WritePosition(args.water_start);
+	gi.WritePosition(args.tr.endpos);
+	gi.multicast(pos, MULTICAST_PVS, false);
+}
+
 /*
 =================
 fire_lead
@@ -293,28 +352,7 @@ static void fire_lead(edict_t *self, const vec3_t &start, const vec3_t &aimdir,
 		pierce_trace(args.tr.endpos, end, self, args, args.mask);
 	}
 
-	// if went through water, determine where the end is and make a bubble trail
-	if (args.water && te_impact != -1)
-	{
-		vec3_t pos, dir;
-
-		dir = args.tr.endpos - args.water_start;
-		dir.normalize();
-		pos = args.tr.endpos + (dir * -2);
-		if (gi.pointcontents(pos) & MASK_WATER)
-			args.tr.endpos = pos;
-		else
-			args.tr = gi.traceline(pos, args.water_start, args.tr.ent != world ? args.tr.ent : nullptr, MASK_WATER);
-
-		pos = args.water_start + args.tr.endpos;
-		pos *= 0.5f;
-
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BUBBLETRAIL);
-		gi.WritePosition(args.water_start);
-		gi.WritePosition(args.tr.endpos);
-		gi.multicast(pos, MULTICAST_PVS, false);
-	}
+	fire_lead_bubbles(args);
 }
 
 /*
@@ -335,12 +373,92 @@ void fire_bullet(edict_t *self, const vec3_t &start, const vec3_t &aimdir, int d
 fire_shotgun
 
 Shoots shotgun pellets.  Used by shotgun and super shotgun.
+
+Pellets are fired as one batch: the muzzle check, water check and aim
+basis are done once and all the spread offsets are rolled up front.
+Each pellet still does its own T_Damage, since armor rounds its share
+per hit; wall puffs are merged and capped. If the muzzle itself is
+blocked we fall back to firing each pellet on its own.
 =================
 */
 void fire_shotgun(edict_t *self, const vec3_t &start, const vec3_t &aimdir, int damage, int kick, int hspread, int vspread, int count, mod_t mod)
 {
-	for (int i = 0; i < count; i++)
-		fire_lead(self, start, aimdir, damage, kick, TE_SHOTGUN, hspread, vspread, mod);
+	constexpr int MAX_BATCH = 32;
+
+	contents_t mask = MASK_PROJECTILE | MASK_WATER;
+
+	// [Paril-KEX]
+	if (self->client && !G_ShouldPlayersCollide(true))
+		mask &= ~CONTENTS_PLAYER;
+
+	bool start_in_water = gi.pointcontents(start) & MASK_WATER;
+
+	if (start_in_water)
+		mask &= ~MASK_WATER;
+
+	// anything between us and the muzzle gets the old treatment
+	if (G_LagTraceLine(self->s.origin, start, self, mask).fraction < 1.f)
+	{
+		for (int i = 0; i < count; i++)
+			fire_lead(self, start, aimdir, damage, kick, TE_SHOTGUN, hspread, vspread, mod);
+		return;
+	}
+
+	vec3_t forward, right, up;
+	AngleVectors(vectoangles(aimdir), forward, right, up);
+
+	const vec3_t center = start + (forward * 8192);
+
+	fire_lead_batch_t batch;
+
+	for (int fired = 0; fired < count; fired += MAX_BATCH)
+	{
+		const int num = min(count - fired, MAX_BATCH);
+		std::array<float, MAX_BATCH> r, u;
+		std::array<vec3_t, MAX_BATCH> ends;
+
+		for (int i = 0; i < num; i++)
+		{
+			r[i] = crandom() * hspread;
+			u[i] = crandom() * vspread;
+		}
+
+		for (int i = 0; i < num; i++)
+			ends[i] = center + (right * r[i]) + (up * u[i]);
+
+		for (int i = 0; i < num; i++)
+		{
+			fire_lead_pierce_t args = {
+				self,
+				start,
+				aimdir,
+				damage,
+				kick,
+				hspread,
+				vspread,
+				mod,
+				TE_SHOTGUN,
+				mask
+			};
+
+			args.batch = &batch;
+
+			if (start_in_water)
+			{
+				args.water = true;
+				args.water_start = start;
+			}
+
+			pierce_trace(start, ends[i], self, args, args.mask);
+			fire_lead_bubbles(args);
+		}
+	}
+
+	for (size_t i = 0; i < batch.num_impacts; i++)
+		G_TempEntity_Impact(TE_SHOTGUN, batch.impacts[i].point, batch.impacts[i].normal);
+
+	if (batch.num_impacts && self->client)
+		PlayerNoise(self, batch.impacts[0].point, PNOISE_IMPACT);
 }
 
 /*
@@ -386,6 +504,7 @@ void fire_blaster(edict_t *self, const vec3_t &start, const vec3_t &dir, int dam
 
 	bolt = G_Spawn();
 	bolt->svflags = SVF_PROJECTILE;
+	G_EdictHot_Sync(bolt);
 	bolt->s.origin = start;
 	bolt->s.old_origin = start;
 	bolt->s.angles = vectoangles(dir);
@@ -563,6 +682,7 @@ void fire_grenade(edict_t *self, const vec3_t &start, const vec3_t &aimdir, int
 		grenade->clipmask &= ~CONTENTS_PLAYER;
 	grenade->solid = SOLID_BBOX;
 	grenade->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(grenade);
 	grenade->flags |= ( FL_DODGE | FL_TRAP );
 	grenade->s.effects |= EF_GRENADE;
 	grenade->speed = speed;
@@ -618,6 +738,7 @@ void fire_grenade2(edict_t *self, const vec3_t &start, const vec3_t &aimdir, int
 		grenade->clipmask &= ~CONTENTS_PLAYER;
 	grenade->solid = SOLID_BBOX;
 	grenade->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(grenade);
 	grenade->flags |= ( FL_DODGE | FL_TRAP );
 	grenade->s.effects |= EF_GRENADE;
 
@@ -708,6 +829,7 @@ edict_t *fire_rocket(edict_t *self, const vec3_t &start, const vec3_t &dir, int
 	rocket->velocity = dir * speed;
 	rocket->movetype = MOVETYPE_FLYMISSILE;
 	rocket->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(rocket);
 	rocket->flags |= FL_DODGE;
 	rocket->clipmask = MASK_PROJECTILE;
 	// [Paril-KEX]
@@ -972,11 +1094,7 @@ THINK(bfg_explode) (edict_t *self) -> void
 			T_Damage(ent, self, self->owner, self->velocity, centroid, vec3_origin, (int) points, 0, DAMAGE_ENERGY, MOD_BFG_EFFECT);
 
 			// Paril: draw BFG lightning laser to enemies
-			gi.WriteByte(svc_temp_entity);
-			gi.WriteByte(TE_BFG_ZAP);
-			gi.WritePosition(self->s.origin);
-			gi.WritePosition(centroid);
-			gi.multicast(self->s.origin, MULTICAST_PHS, false);
+			G_TempEntity_Beam(TE_BFG_ZAP, self->s.origin, centroid, MULTICAST_PHS);
 		}
 	}
 
@@ -1127,11 +1245,7 @@ THINK(bfg_think) (edict_t *self) -> void
 		
 		pierce_trace(start, end, self, args, CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_PLAYER | CONTENTS_DEADMONSTER);
 
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BFG_LASER);
-		gi.WritePosition(self->s.origin);
-		gi.WritePosition(tr.endpos);
-		gi.multicast(self->s.origin, MULTICAST_PHS, false);
+		G_TempEntity_Beam(TE_BFG_LASER, self->s.origin, tr.endpos, MULTICAST_PHS);
 	}
 
 	self->nextthink = level.time + 10_hz;
@@ -1148,6 +1262,7 @@ void fire_bfg(edict_t *self, const vec3_t &start, const vec3_t &dir, int damage,
 	bfg->movetype = MOVETYPE_FLYMISSILE;
 	bfg->clipmask = MASK_PROJECTILE;
 	bfg->svflags = SVF_PROJECTILE;
+	G_EdictHot_Sync(bfg);
 	// [Paril-KEX]
 	if (self->client && !G_ShouldPlayersCollide(true))
 		bfg->clipmask &= ~CONTENTS_PLAYER;
@@ -1204,6 +1319,7 @@ void fire_disintegrator(edict_t *self, const vec3_t &start, const vec3_t &forwar
 	bfg->s.effects |= EF_TAGTRAIL | EF_ANIM_ALL;
 	bfg->s.renderfx |= RF_TRANSLUCENT;
 	bfg->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(bfg);
 	bfg->flags |= FL_DODGE;
 	bfg->s.modelindex = gi.modelindex("sprites/s_bfg1.sp2");
 	bfg->owner = self;
@@ -253,8 +253,8 @@ bool canReach(edict_t *self, edict_t *other)
 
 edict_t *medic_FindDeadMonster(edict_t *self)
 {
+	static std::vector<edict_t *> corpses;
 	float	 radius;
-	edict_t *ent = nullptr;
 	edict_t *best = nullptr;
 
 	if (self->monsterinfo.react_to_damage_time > level.time)
@@ -265,7 +265,9 @@ edict_t *medic_FindDeadMonster(edict_t *self)
 	else
 		radius = 1024;
 
-	while ((ent = findradius(ent, self->s.origin, radius)) != nullptr)
+	G_FindCorpses(self->s.origin, radius, corpses);
+
+	for (edict_t *ent : corpses)
 	{
 		if (ent == self)
 			continue;
@@ -961,7 +963,7 @@ void medic_cable_attack(edict_t *self)
 			int32_t old_gib_health = self->enemy->gib_health;
 
 			st = {};
-			st.keys_specified.emplace("reinforcements");
+			st.mark_key_specified("reinforcements");
 			st.reinforcements = "";
 
 			ED_CallSpawn(self->enemy);
@@ -972,6 +974,7 @@ void medic_cable_attack(edict_t *self)
 
 			self->enemy->gib_health = old_gib_health / 2;
 			self->enemy->health = self->enemy->max_health = old_max_health;
+			G_Corpse_Remove(self->enemy);
 			self->enemy->monsterinfo.power_armor_power = self->enemy->monsterinfo.max_power_armor_power = old_power_armor_power;
 			self->enemy->monsterinfo.power_armor_type = self->enemy->monsterinfo.initial_power_armor_type = old_power_armor_type;
 			self->enemy->monsterinfo.base_health = old_base_health;
@@ -1163,47 +1163,179 @@ bool SV_CloseEnough(edict_t *ent, edict_t *goal, float dist)
 	return true;
 }
 
-static bool M_NavPathToGoal(edict_t *self, float dist, const vec3_t &goal)
+/*
+===============================================================================
+
+NAV PATH QUEUE
+
+Monster re-paths don't call the pathfinder straight away. They're queued
+with a priority and a fixed number are handed out at the start of each
+frame, closest-to-a-player first. A monster that already has a path
+keeps following it until the new one lands; one with nothing to follow
+may spend left-over budget immediately, or falls back to plain chasing.
+
+===============================================================================
+*/
+
+constexpr int32_t NAV_PATH_REQUESTS_PER_FRAME = 4;
+
+struct nav_path_queue_entry_t
 {
-	// mark us as *trying* now (nav_pos is valid)
-	self->monsterinfo.aiflags |= AI_PATHING;
+	uint32_t number;
+	int32_t	 spawn_count;
+	float	 dist;
+	float	 priority; // lower goes first
+};
 
-	vec3_t &path_to = (self->monsterinfo.nav_path.returnCode == PathReturnCode::TraversalPending) ?
-		self->monsterinfo.nav_path.secondMovePoint : self->monsterinfo.nav_path.firstMovePoint;
+static std::vector<nav_path_queue_entry_t> nav_path_queue;
+static int32_t nav_path_budget;
 
-	if ((self->monsterinfo.nav_path.returnCode != PathReturnCode::TraversalPending && (path_to - self->s.origin).length() <= (self->size.length() * 0.5f)) ||
-		self->monsterinfo.nav_path_cache_time <= level.time)
+static void M_NavPathFillRequest(edict_t *self, float dist, PathRequest &request)
+{
+	if (self->enemy)
+		request.goal = self->enemy->s.origin;
+	else
+		request.goal = self->goalentity->s.origin;
+	request.moveDist = dist;
+	if (g_debug_monster_paths->integer == 1)
+		request.debugging.drawTime = gi.frame_time_s;
+	request.start = self->s.origin;
+	request.pathFlags = PathFlags::Walk;
+
+	if (self->monsterinfo.can_jump || (self->flags & FL_FLY))
 	{
-		PathRequest request;
-		if (self->enemy)
-			request.goal = self->enemy->s.origin;
-		else
-			request.goal = self->goalentity->s.origin;
-		request.moveDist = dist;
-		if (g_debug_monster_paths->integer == 1)
-			request.debugging.drawTime = gi.frame_time_s;
-		request.start = self->s.origin;
-		request.pathFlags = PathFlags::Walk;
-
-		if (self->monsterinfo.can_jump || (self->flags & FL_FLY))
+		if (self->monsterinfo.jump_height)
 		{
-			if (self->monsterinfo.jump_height)
-			{
-				request.pathFlags |= PathFlags::BarrierJump;
-				request.traversals.jumpHeight = self->monsterinfo.jump_height;
-			}
-			if (self->monsterinfo.drop_height)
-			{
-				request.pathFlags |= PathFlags::WalkOffLedge;
-				request.traversals.dropHeight = self->monsterinfo.drop_height;
-			}
+			request.pathFlags |= PathFlags::BarrierJump;
+			request.traversals.jumpHeight = self->monsterinfo.jump_height;
+		}
+		if (self->monsterinfo.drop_height)
+		{
+			request.pathFlags |= PathFlags::WalkOffLedge;
+			request.traversals.dropHeight = self->monsterinfo.drop_height;
+		}
+	}
+
+	if (self->flags & FL_FLY)
+	{
+		request.nodeSearch.maxHeight = request.nodeSearch.minHeight = 8192.f;
+		request.pathFlags |= PathFlags::LongJump;
+	}
+}
+
+/*
+=============
+NAV PATH CACHE
+
+Paths found this frame, kept so that monsters chasing the same thing
+from roughly the same place can share one result. Keyed on the goal
+snapped to a grid plus everything else in the request that changes
+what the pathfinder is allowed to do; a start point is a hit if it lies
+within the corridor between a cached start and its first move point.
+Cleared every frame, so nothing here outlives the world it describes.
+=============
+*/
+
+constexpr float NAV_PATH_CACHE_GOAL_GRID = 64.f;
+constexpr float NAV_PATH_CACHE_CORRIDOR = 48.f;
+constexpr float NAV_PATH_CACHE_STEP = 24.f;
+
+struct nav_path_cache_entry_t
+{
+	std::array<int32_t, 3> goal;
+	uint32_t			   flags;
+	float				   jump_height, drop_height, node_height;
+	vec3_t				   start;
+	PathInfo			   info;
+};
+
+static struct
+{
+	std::vector<nav_path_cache_entry_t> entries;
+	uint64_t hits, misses;
+} nav_path_cache;
+
+static bool M_NavPathCacheKeyMatches(const nav_path_cache_entry_t &entry, const std::array<int32_t, 3> &goal, const PathRequest &request)
+{
+	return entry.goal == goal &&
+		entry.flags == request.pathFlags &&
+		entry.jump_height == request.traversals.jumpHeight &&
+		entry.drop_height == request.traversals.dropHeight &&
+		entry.node_height == request.nodeSearch.maxHeight;
+}
+
+static std::array<int32_t, 3> M_NavPathCacheGoal(const vec3_t &goal)
+{
+	return {
+		(int32_t) floorf(goal.x / NAV_PATH_CACHE_GOAL_GRID),
+		(int32_t) floorf(goal.y / NAV_PATH_CACHE_GOAL_GRID),
+		(int32_t) floorf(goal.z / NAV_PATH_CACHE_GOAL_GRID)
+	};
+}
+
+static const PathInfo *M_NavPathCacheFind(const PathRequest &request)
+{
+	const std::array<int32_t, 3> goal = M_NavPathCacheGoal(request.goal);
+
+	for (const nav_path_cache_entry_t &entry : nav_path_cache.entries)
+	{
+		if (!M_NavPathCacheKeyMatches(entry, goal, request))
+			continue;
+
+		// traversals start right where they were found
+		if (entry.info.returnCode == PathReturnCode::TraversalPending)
+		{
+			if ((request.start - entry.start).lengthSquared() <= NAV_PATH_CACHE_STEP * NAV_PATH_CACHE_STEP)
+				return &entry.info;
+
+			continue;
 		}
 
-		if (self->flags & FL_FLY)
+		// must be on the same floor, and not past the first
+		// move point along the cached segment
+		if (fabsf(request.start.z - entry.start.z) > NAV_PATH_CACHE_STEP)
+			continue;
+
+		vec3_t segment = entry.info.firstMovePoint - entry.start;
+		float  length_sqr = segment.lengthSquared();
+		float  t = length_sqr > 0.f ? (request.start - entry.start).dot(segment) / length_sqr : 0.f;
+
+		if (t < 0.f)
 		{
-			request.nodeSearch.maxHeight = request.nodeSearch.minHeight = 8192.f;
-			request.pathFlags |= PathFlags::LongJump;
+			if ((request.start - entry.start).lengthSquared() > NAV_PATH_CACHE_CORRIDOR * NAV_PATH_CACHE_CORRIDOR)
+				continue;
 		}
+		else if (t >= 1.f)
+			continue;
+		else if ((request.start - (entry.start + segment * t)).lengthSquared() > NAV_PATH_CACHE_CORRIDOR * NAV_PATH_CACHE_CORRIDOR)
+			continue;
+
+		return &entry.info;
+	}
+
+	return nullptr;
+}
+
+// run the pathfinder for self right now; returns false on failure
+static bool M_NavPathFind(edict_t *self, float dist)
+{
+	PathRequest request;
+	M_NavPathFillRequest(self, dist, request);
+
+	self->monsterinfo.nav_path_queued = false;
+
+	// debug drawing wants every path drawn
+	const PathInfo *cached = (g_debug_monster_paths->integer == 1) ? nullptr : M_NavPathCacheFind(request);
+
+	if (cached)
+	{
+		nav_path_cache.hits++;
+		self->monsterinfo.nav_path = *cached;
+	}
+	else
+	{
+		nav_path_cache.misses++;
+		nav_path_budget--;
 
 		if (!gi.GetPathToGoal(request, self->monsterinfo.nav_path))
 		{
@@ -1213,7 +1345,130 @@ static bool M_NavPathToGoal(edict_t *self, float dist, const vec3_t &goal)
 			return false;
 		}
 
-		self->monsterinfo.nav_path_cache_time = level.time + 2_sec;
+		nav_path_cache.entries.push_back({
+			M_NavPathCacheGoal(request.goal), request.pathFlags,
+			request.traversals.jumpHeight, request.traversals.dropHeight, request.nodeSearch.maxHeight,
+			request.start, self->monsterinfo.nav_path
+		});
+	}
+
+	self->monsterinfo.nav_path_cache_time = level.time + 2_sec;
+	return true;
+}
+
+void M_NavPathQueue_Clear()
+{
+	nav_path_queue.clear();
+	nav_path_budget = 0;
+	nav_path_cache.entries.clear();
+	nav_path_cache.hits = nav_path_cache.misses = 0;
+}
+
+static void M_NavPathEnqueue(edict_t *self, float dist, bool enemy_visible)
+{
+	if (self->monsterinfo.nav_path_queued)
+		return;
+
+	float priority = std::numeric_limits<float>::infinity();
+
+	for (auto player : active_players())
+		priority = min(priority, (player->s.origin - self->s.origin).lengthSquared());
+
+	// a monster that can see who it's after is more likely
+	// to be noticed going the wrong way
+	if (enemy_visible)
+		priority *= 0.25f;
+
+	nav_path_queue.push_back({ (uint32_t) (self - g_edicts), self->spawn_count, dist, priority });
+	self->monsterinfo.nav_path_queued = true;
+}
+
+/*
+=============
+M_NavPathQueue_Run
+
+Called once a frame; services the best queued requests
+and resets the budget for immediate ones. Cache hits
+don't count against the budget.
+=============
+*/
+void M_NavPathQueue_Run()
+{
+	nav_path_budget = NAV_PATH_REQUESTS_PER_FRAME;
+	nav_path_cache.entries.clear();
+
+	if (g_debug_nav_path_cache->integer && !(level.time.milliseconds() % 5000))
+	{
+		uint64_t total = nav_path_cache.hits + nav_path_cache.misses;
+		gi.Com_PrintFmt("nav path cache: {} hits, {} misses ({:.1f}% hit)\n", nav_path_cache.hits, nav_path_cache.misses,
+			total ? (nav_path_cache.hits * 100.0 / total) : 0.0);
+	}
+
+	if (nav_path_queue.empty())
+		return;
+
+	std::sort(nav_path_queue.begin(), nav_path_queue.end(),
+		[](const nav_path_queue_entry_t &a, const nav_path_queue_entry_t &b) { return a.priority < b.priority; });
+
+	size_t i = 0;
+
+	for (; i < nav_path_queue.size() && nav_path_budget > 0; i++)
+	{
+		const nav_path_queue_entry_t &entry = nav_path_queue[i];
+		edict_t *self = &g_edicts[entry.number];
+
+		// slot reused, or we stopped wanting it
+		if (!self->inuse || self->spawn_count != entry.spawn_count || !self->monsterinfo.nav_path_queued)
+			continue;
+		else if (self->health <= 0 || (!self->enemy && !self->goalentity))
+		{
+			self->monsterinfo.nav_path_queued = false;
+			continue;
+		}
+
+		// a failure gets the same back-off M_MoveToPath would give it
+		if (!M_NavPathFind(self, entry.dist) && self->monsterinfo.nav_path.returnCode > PathReturnCode::StartPathErrors)
+			self->monsterinfo.path_wait_time = level.time + 10_sec;
+	}
+
+	nav_path_queue.erase(nav_path_queue.begin(), nav_path_queue.begin() + i);
+	nav_path_budget = max(0, nav_path_budget);
+}
+
+static bool M_NavPathToGoal(edict_t *self, float dist, const vec3_t &goal, bool enemy_visible)
+{
+	// mark us as *trying* now (nav_pos is valid)
+	self->monsterinfo.aiflags |= AI_PATHING;
+
+	vec3_t &path_to = (self->monsterinfo.nav_path.returnCode == PathReturnCode::TraversalPending) ?
+		self->monsterinfo.nav_path.secondMovePoint : self->monsterinfo.nav_path.firstMovePoint;
+
+	bool reached = self->monsterinfo.nav_path.returnCode != PathReturnCode::TraversalPending && (path_to - self->s.origin).length() <= (self->size.length() * 0.5f);
+
+	if (reached || self->monsterinfo.nav_path_cache_time <= level.time)
+	{
+		// nav_path is only meaningful once a lookup has succeeded;
+		// a monster that never pathed has a zeroed one
+		bool has_path = self->monsterinfo.nav_path_cache_time && self->monsterinfo.nav_path.returnCode < PathReturnCode::StartPathErrors;
+
+		if (!has_path || reached)
+		{
+			// nothing useful to follow in the meantime; use up spare budget
+			// now if there is any, otherwise chase normally until our turn
+			if (nav_path_budget <= 0)
+			{
+				// a reached point is no use any more; forget it so
+				// nothing follows it until the new one comes in
+				self->monsterinfo.nav_path_cache_time = 0_ms;
+				M_NavPathEnqueue(self, dist, enemy_visible);
+				return false;
+			}
+
+			if (!M_NavPathFind(self, dist))
+				return false;
+		}
+		else
+			M_NavPathEnqueue(self, dist, enemy_visible);
 	}
 
 	float yaw;
@@ -1312,7 +1567,7 @@ static bool M_MoveToPath(edict_t *self, float dist)
 			// path pretty close to the enemy, then let normal Quake movement take over.
 			if ( range_to(self, self->enemy) > 240.f ||
 					fabs(self->s.origin.z - self->enemy->s.origin.z) > max(self->maxs.z, -self->mins.z) ) {
-				if ( M_NavPathToGoal( self, dist, self->enemy->s.origin ) ) {
+				if ( M_NavPathToGoal( self, dist, self->enemy->s.origin, true ) ) {
 					return true;
 				}
 				self->monsterinfo.aiflags &= ~AI_TEMP_MELEE_COMBAT;
@@ -1324,7 +1579,7 @@ static bool M_MoveToPath(edict_t *self, float dist)
 			// most mixed combat AI have fairly short range attacks, so try to path within mid range.
 			if ( range_to(self, self->enemy) > RANGE_NEAR ||
 					fabs(self->s.origin.z - self->enemy->s.origin.z) > max(self->maxs.z, -self->mins.z) * 2.0f ) {
-				if ( M_NavPathToGoal( self, dist, self->enemy->s.origin ) ) {
+				if ( M_NavPathToGoal( self, dist, self->enemy->s.origin, true ) ) {
 					return true;
 				}
 			} else {
@@ -1333,7 +1588,7 @@ static bool M_MoveToPath(edict_t *self, float dist)
 		}
 	} else {
 		// we can't see our enemy, let's see if we can path to them
-		if ( M_NavPathToGoal( self, dist, self->enemy->s.origin ) ) {
+		if ( M_NavPathToGoal( self, dist, self->enemy->s.origin, false ) ) {
 			return true;
 		}
 	}
@@ -1341,6 +1596,11 @@ static bool M_MoveToPath(edict_t *self, float dist)
 	if (!self->inuse)
 		return false;
 
+	// no usable path, but one is on its way; chase normally until it
+	// lands, without counting the wait as being blocked
+	if (self->monsterinfo.nav_path_queued)
+		return false;
+
 	if (self->monsterinfo.nav_path.returnCode > PathReturnCode::StartPathErrors)
 	{
 		self->monsterinfo.path_wait_time = level.time + 10_sec;
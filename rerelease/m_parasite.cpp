@@ -592,6 +592,7 @@ static void fire_proboscis(edict_t *self, vec3_t start, vec3_t dir, float speed)
 	tip->think = proboscis_think;
 	tip->nextthink = level.time + FRAME_TIME_S; // start doing stuff on next frame
 	tip->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(tip);
 
 	edict_t *segment = G_Spawn();
 	segment->s.modelindex = gi.modelindex("models/monsters/parasite/segment/tris.md2");
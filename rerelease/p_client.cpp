@@ -1006,9 +1006,90 @@ float PlayersRangeFromSpot(edict_t *spot)
 	return bestplayerdistance;
 }
 
+/*
+================
+G_SpawnPointsOfClass
+
+Spawn points are looked up by class on every respawn, so each class
+is gathered once per level, in entity order, and reused until one of
+its points goes away. classname must be a literal, since the cache
+keeps it as its key.
+================
+*/
+static struct
+{
+	std::unordered_map<std::string_view, std::vector<edict_t *>> classes;
+} spawn_point_cache;
+
+void G_SpawnPoints_Invalidate()
+{
+	spawn_point_cache.classes.clear();
+}
+
+const std::vector<edict_t *> &G_SpawnPointsOfClass(const char *classname)
+{
+	auto it = spawn_point_cache.classes.find(classname);
+
+	if (it != spawn_point_cache.classes.end())
+	{
+		bool stale = false;
+
+		for (edict_t *spot : it->second)
+			if (!spot->inuse || !spot->classname || strcmp(spot->classname, classname))
+			{
+				stale = true;
+				break;
+			}
+
+		if (!stale)
+			return it->second;
+	}
+	else
+		it = spawn_point_cache.classes.emplace(classname, std::vector<edict_t *>()).first;
+
+	std::vector<edict_t *> &points = it->second;
+	edict_t				   *spot = nullptr;
+
+	points.clear();
+
+	while ((spot = G_FindByString<&edict_t::classname>(spot, classname)) != nullptr)
+		points.push_back(spot);
+
+	return points;
+}
+
+// true if a live player or monster is near enough to the box
+// that the engine trace could find it
+static bool SpawnPointBlockerNear(const vec3_t &mins, const vec3_t &maxs, edict_t *spot)
+{
+	for (uint32_t n = 1; n <= game.maxclients; n++)
+	{
+		edict_t *player = &g_edicts[n];
+
+		if (player->inuse && player->solid != SOLID_NOT && boxes_intersect(player->absmin, player->absmax, mins, maxs))
+			return true;
+	}
+
+	for (uint32_t i = g_edict_hot.monster.next(game.maxclients + 1, globals.num_edicts); i < globals.num_edicts;
+		 i = g_edict_hot.monster.next(i + 1, globals.num_edicts))
+	{
+		edict_t *e = &g_edicts[i];
+
+		if (e != spot && e->inuse && e->solid != SOLID_NOT && boxes_intersect(e->absmin, e->absmax, mins, maxs))
+			return true;
+	}
+
+	return false;
+}
+
 bool SpawnPointClear(edict_t *spot)
 {
 	vec3_t p = spot->s.origin + vec3_t{0, 0, 9.f};
+
+	// nothing around to be stuck in, so don't bother tracing
+	if (!SpawnPointBlockerNear(p + PLAYER_MINS, p + PLAYER_MAXS, spot))
+		return true;
+
 	return !gi.trace(p, PLAYER_MINS, PLAYER_MAXS, p, spot, CONTENTS_PLAYER | CONTENTS_MONSTER).startsolid;
 }
 
@@ -1025,8 +1106,7 @@ select_spawn_result_t SelectDeathmatchSpawnPoint(bool farthest, bool force_spawn
 	spawn_points.clear();
 
 	// gather all spawn points 
-	edict_t *spot = nullptr;
-	while ((spot = G_FindByString<&edict_t::classname>(spot, "info_player_deathmatch")) != nullptr)
+	for (edict_t *spot : G_SpawnPointsOfClass("info_player_deathmatch"))
 		spawn_points.push_back({ spot, PlayersRangeFromSpot(spot) });
 
 	// no points
@@ -1035,20 +1115,18 @@ select_spawn_result_t SelectDeathmatchSpawnPoint(bool farthest, bool force_spawn
 		// try CTF spawns...
 		if (fallback_to_ctf_or_start)
 		{
-			spot = nullptr;
-			while ((spot = G_FindByString<&edict_t::classname>(spot, "info_player_team1")) != nullptr)
+			for (edict_t *spot : G_SpawnPointsOfClass("info_player_team1"))
 				spawn_points.push_back({ spot, PlayersRangeFromSpot(spot) });
-			spot = nullptr;
-			while ((spot = G_FindByString<&edict_t::classname>(spot, "info_player_team2")) != nullptr)
+			for (edict_t *spot : G_SpawnPointsOfClass("info_player_team2"))
 				spawn_points.push_back({ spot, PlayersRangeFromSpot(spot) });
 
 			// we only have an info_player_start then
 			if (spawn_points.size() == 0)
 			{
-				spot = G_FindByString<&edict_t::classname>(nullptr, "info_player_start");
+				const std::vector<edict_t *> &starts = G_SpawnPointsOfClass("info_player_start");
 
-				if (spot)
-					spawn_points.push_back({ spot, PlayersRangeFromSpot(spot) });
+				if (starts.size())
+					spawn_points.push_back({ starts[0], PlayersRangeFromSpot(starts[0]) });
 
 				// map is malformed
 				if (spawn_points.size() == 0)
@@ -2917,6 +2995,10 @@ bool ClientConnect(edict_t *ent, char *userinfo, const char *social_id, bool isB
 		ent->svflags |= SVF_BOT;
 	}
 
+	// Map Trainer: only the bots it asked for become rivals
+	ent->client->map_trainer_rival = isBot && MapTrainer_ClaimRivalBot();
+	ent->client->map_trainer_rival_order = -1;
+
 	Q_strlcpy(ent->client->pers.social_id, social_id, sizeof(ent->client->pers.social_id));
 
 	if (game.maxclients > 1)
@@ -3175,6 +3257,15 @@ void ClientThink(edict_t *ent, usercmd_t *ucmd)
 	client->latched_buttons |= client->buttons & ~client->oldbuttons;
 	client->cmd = *ucmd;
 
+	// track how far into its current frame the client is, for lag compensation
+	if (ucmd->server_frame != client->lag_cmd_frame)
+	{
+		client->lag_cmd_frame = ucmd->server_frame;
+		client->lag_cmd_msec = 0;
+	}
+
+	client->lag_cmd_msec += ucmd->msec;
+
 	if ((ucmd->buttons & BUTTON_CROUCH) && pm_config.n64_physics)
 	{
 		if (client->pers.n64_crouch_warn_times < 12 &&
@@ -1247,11 +1247,31 @@ static void P_RunMegaHealth(edict_t *ent)
 	}
 }
 
+// players' rewound boxes while a lag compensated shot is being fired.
+// nobody is moved or relinked; G_LagTraceLine tests against these
+// boxes directly and merges the result with a trace of the world.
+struct lag_box_t
+{
+	edict_t *player;
+	vec3_t	 origin;
+	vec3_t	 mins, maxs;
+};
+
+static struct
+{
+	bool	  active;
+	size_t	  num_boxes;
+	lag_box_t boxes[MAX_CLIENTS];
+} lag_compensation;
+
 // [Paril-KEX] push all players' origins back to match their lag compensation
 void G_LagCompensate(edict_t *from_player, const vec3_t &start, const vec3_t &dir)
 {
 	uint32_t current_frame = gi.ServerFrame();
 
+	lag_compensation.active = false;
+	lag_compensation.num_boxes = 0;
+
 	// if you need this to fight monsters, you need help
 	if (!deathmatch->integer)
 		return;
@@ -1264,12 +1284,23 @@ void G_LagCompensate(edict_t *from_player, const vec3_t &start, const vec3_t &di
 
 	int32_t frame_delta = (current_frame - from_player->client->cmd.server_frame) + 1;
 
+	// the client draws frame_delta back, lerped towards the
+	// next one by however long it has had it
+	float frac = 0.f;
+
+	if (from_player->client->lag_cmd_frame == from_player->client->cmd.server_frame)
+		frac = clamp(from_player->client->lag_cmd_msec / (float) gi.frame_time_ms, 0.f, 1.f);
+
 	for (auto player : active_players())
 	{
 		// we aren't gonna hit ourselves
 		if (player == from_player)
 			continue;
 
+		// dead players are left where they are
+		if (player->svflags & SVF_DEADMONSTER)
+			continue;
+
 		// not enough data, spare them
 		if (player->client->num_lag_origins < frame_delta)
 			continue;
@@ -1290,43 +1321,192 @@ void G_LagCompensate(edict_t *from_player, const vec3_t &start, const vec3_t &di
 			return;
 		}
 
-		const vec3_t &lag_origin = (game.lag_origins + ((player->s.number - 1) * game.max_lag_origins))[lag_id];
+		const lag_sample_t *samples = game.lag_origins + ((player->s.number - 1) * game.max_lag_origins);
+		const lag_sample_t &from = samples[lag_id];
+		const lag_sample_t &to = samples[(lag_id + 1) % game.max_lag_origins];
+		vec3_t				lag_origin = lerp(from.origin, to.origin, frac);
 
 		// no way they'd be hit if they aren't in the PVS
 		if (!gi.inPVS(lag_origin, start, false))
 			continue;
 
-		// only back up once
-		if (!player->client->is_lag_compensated)
-		{
-			player->client->is_lag_compensated = true;
-			player->client->lag_restore_origin = player->s.origin;
-		}
-			
-		player->s.origin = lag_origin;
+		const lag_sample_t &box = (frac < 0.5f) ? from : to;
 
-		gi.linkentity(player);
+		lag_compensation.boxes[lag_compensation.num_boxes++] = { player, lag_origin, box.mins, box.maxs };
 	}
+
+	lag_compensation.active = lag_compensation.num_boxes != 0;
 }
 
 // [Paril-KEX] pop everybody's lag compensation values
 void G_UnLagCompensate()
 {
+	lag_compensation.active = false;
+	lag_compensation.num_boxes = 0;
+}
+
+// clip a line against an axial box; returns the entry
+// fraction, a value < 0 if the line starts inside the box,
+// or a value > 1 if the line misses
+static float G_LagClipBox(const vec3_t &start, const vec3_t &end, const vec3_t &mins, const vec3_t &maxs, int &hit_axis, bool &hit_max)
+{
+	float enter = -std::numeric_limits<float>::infinity();
+	float leave = std::numeric_limits<float>::infinity();
+
+	hit_axis = 0;
+	hit_max = false;
+
+	for (int i = 0; i < 3; i++)
+	{
+		float delta = end[i] - start[i];
+
+		if (!delta)
+		{
+			if (start[i] < mins[i] || start[i] > maxs[i])
+				return 2.f;
+
+			continue;
+		}
+
+		float t0 = (mins[i] - start[i]) / delta;
+		float t1 = (maxs[i] - start[i]) / delta;
+		bool  near_max = t0 > t1;
+
+		if (near_max)
+			std::swap(t0, t1);
+
+		if (t0 > enter)
+		{
+			enter = t0;
+			hit_axis = i;
+			hit_max = near_max;
+		}
+
+		leave = min(leave, t1);
+
+		if (enter > leave)
+			return 2.f;
+	}
+
+	// entirely behind the start, or past the end
+	if (leave < 0.f || enter > 1.f)
+		return 2.f;
+
+	// inside on every axis at the start
+	if (enter < 0.f)
+		return -1.f;
+
+	return enter;
+}
+
+/*
+=================
+G_LagTraceLine
+
+Traces a line like gi.traceline, but against players' lag compensated
+boxes rather than where they are now. The world and everything else is
+traced normally with players masked out, then each player is tested
+game-side and the closest hit wins.
+=================
+*/
+trace_t G_LagTraceLine(const vec3_t &start, const vec3_t &end, edict_t *passent, contents_t mask)
+{
+	if (!lag_compensation.active || !(mask & CONTENTS_PLAYER))
+		return gi.traceline(start, end, passent, mask);
+
+	static csurface_t null_surface;
+	trace_t			  tr = gi.traceline(start, end, passent, mask & ~CONTENTS_PLAYER);
+	float			  length = (end - start).length();
+
 	for (auto player : active_players())
 	{
-		if (player->client->is_lag_compensated)
+		if (player == passent || (passent && player->owner == passent) || (passent && passent->owner == player))
+			continue;
+		// pierced, or otherwise out of the world
+		else if (player->solid == SOLID_NOT)
+			continue;
+
+		const lag_box_t *box = nullptr;
+
+		for (size_t i = 0; i < lag_compensation.num_boxes; i++)
+			if (lag_compensation.boxes[i].player == player)
+				box = &lag_compensation.boxes[i];
+
+		// not rewound; let the engine clip against them where they are,
+		// if the line gets anywhere near them
+		if (!box)
 		{
-			player->client->is_lag_compensated = false;
-			player->s.origin = player->client->lag_restore_origin;
-			gi.linkentity(player);
+			int	 axis;
+			bool hit_max;
+
+			if (G_LagClipBox(start, end, player->absmin, player->absmax, axis, hit_max) > 1.f)
+				continue;
+
+			trace_t clip = gi.clip(player, start, end, mask);
+
+			if (clip.fraction < tr.fraction)
+			{
+				tr = clip;
+				tr.ent = player;
+			}
+
+			continue;
 		}
+
+		int	  axis;
+		bool  hit_max;
+		float frac = G_LagClipBox(start, end, box->origin + box->mins, box->origin + box->maxs, axis, hit_max);
+
+		if (frac > 1.f)
+			continue;
+
+		if (frac < 0.f)
+		{
+			// started inside them
+			if (tr.startsolid)
+				continue;
+
+			tr.fraction = 0.f;
+			tr.startsolid = true;
+			tr.allsolid = G_LagClipBox(end, end, box->origin + box->mins, box->origin + box->maxs, axis, hit_max) <= 1.f;
+			tr.endpos = start;
+		}
+		else
+		{
+			// back off like the engine does
+			if (length)
+				frac = max(0.f, frac - (0.03125f / length));
+
+			if (frac >= tr.fraction)
+				continue;
+
+			tr.fraction = frac;
+			tr.startsolid = tr.allsolid = false;
+			tr.endpos = start + (end - start) * frac;
+		}
+
+		tr.plane = {};
+		tr.plane.normal[axis] = hit_max ? 1.f : -1.f;
+		tr.plane.dist = hit_max ? (box->origin[axis] + box->maxs[axis]) : -(box->origin[axis] + box->mins[axis]);
+		tr.plane.type = axis;
+		tr.plane.signbits = hit_max ? 0 : (1 << axis);
+		tr.plane2 = {};
+		tr.surface = tr.surface2 = &null_surface;
+		tr.contents = CONTENTS_PLAYER;
+		tr.ent = player;
 	}
+
+	return tr;
 }
 
 // [Paril-KEX] save the current lag compensation value
 static void G_SaveLagCompensation(edict_t *ent)
 {
-	(game.lag_origins + ((ent->s.number - 1) * game.max_lag_origins))[ent->client->next_lag_origin] = ent->s.origin;
+	lag_sample_t &sample = (game.lag_origins + ((ent->s.number - 1) * game.max_lag_origins))[ent->client->next_lag_origin];
+
+	sample.origin = ent->s.origin;
+	sample.mins = ent->mins;
+	sample.maxs = ent->maxs;
 	ent->client->next_lag_origin = (ent->client->next_lag_origin + 1) % game.max_lag_origins;
 
 	if (ent->client->num_lag_origins < game.max_lag_origins)
@@ -1492,11 +1672,8 @@ void ClientEndServerFrame(edict_t *ent)
 	// ZOID
 	if (ent->client->menudirty && ent->client->menutime <= level.time)
 	{
-		if (ent->client->menu)
-		{
-			PMenu_Do_Update(ent);
+		if (ent->client->menu && PMenu_Do_Update(ent))
 			gi.unicast(ent, true);
-		}
 		ent->client->menutime = level.time;
 		ent->client->menudirty = false;
 	}
@@ -1508,7 +1685,8 @@ void ClientEndServerFrame(edict_t *ent)
 		// ZOID
 		if (ent->client->menu)
 		{
-			PMenu_Do_Update(ent);
+			// periodic refresh; resend even if nothing changed
+			PMenu_Do_Update(ent, true);
 			ent->client->menudirty = false;
 		}
 		else
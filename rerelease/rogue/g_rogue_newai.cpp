@@ -267,6 +267,173 @@ int		 hint_paths_present;
 edict_t *hint_path_start[MAX_HINT_CHAINS];
 int		 num_hint_paths;
 
+// =============
+// hint path graph - built once by InitHintPaths from the linked
+// chains, so monsters that lose their target query nodes by
+// position instead of re-walking and re-linking every chain.
+// =============
+constexpr float HINT_NODE_RANGE = 512.f;
+
+struct hint_node_t
+{
+	edict_t *ent;
+	int32_t	 chain;		 // hint_chain_id
+	int32_t	 position;	 // index along the chain
+	int32_t	 prev, next; // neighbours along the chain, -1 at the ends
+
+	// last enemy visibility test, shared by every monster
+	// hunting that enemy this frame
+	edict_t *vis_enemy;
+	gtime_t	 vis_time;
+	bool	 vis_result;
+};
+
+static struct
+{
+	std::vector<hint_node_t> nodes;
+	std::vector<int32_t>	 node_of_edict;
+
+	// uniform grid of HINT_NODE_RANGE sized cells; cell_start
+	// indexes into cell_nodes, with one extra end entry
+	vec3_t				 grid_mins;
+	int32_t				 grid_size[3];
+	std::vector<int32_t> cell_start;
+	std::vector<int32_t> cell_nodes;
+} hint_graph;
+
+static int32_t HintGraph_CellAxis(const vec3_t &p, int axis)
+{
+	return clamp((int32_t) floorf((p[axis] - hint_graph.grid_mins[axis]) / HINT_NODE_RANGE), 0, hint_graph.grid_size[axis] - 1);
+}
+
+static int32_t HintGraph_Cell(const vec3_t &p)
+{
+	return HintGraph_CellAxis(p, 0) +
+		(HintGraph_CellAxis(p, 1) + HintGraph_CellAxis(p, 2) * hint_graph.grid_size[1]) * hint_graph.grid_size[0];
+}
+
+static void HintGraph_Build()
+{
+	hint_graph.nodes.clear();
+	hint_graph.node_of_edict.assign(globals.num_edicts, -1);
+	hint_graph.cell_start.clear();
+	hint_graph.cell_nodes.clear();
+
+	// nodes, in the same order the chains are walked
+	for (int32_t i = 0; i < num_hint_paths; i++)
+	{
+		int32_t prev = -1, position = 0;
+
+		for (edict_t *e = hint_path_start[i]; e; e = e->hint_chain)
+		{
+			int32_t &slot = hint_graph.node_of_edict[e->s.number];
+			int32_t	 index = (int32_t) hint_graph.nodes.size();
+
+			// looped back onto ourselves
+			if (slot != -1 && e->hint_chain_id == i)
+				break;
+
+			hint_graph.nodes.push_back({ e, i, position++, prev, -1 });
+
+			if (prev != -1)
+				hint_graph.nodes[prev].next = index;
+			prev = index;
+
+			// an endpoint shared by two chains gets a node on each, but the
+			// edict maps to the node of the chain InitHintPaths gave it
+			if (e->hint_chain_id != i)
+				break;
+
+			slot = index;
+		}
+	}
+
+	if (hint_graph.nodes.empty())
+		return;
+
+	// spatial index
+	vec3_t mins = hint_graph.nodes[0].ent->s.origin, maxs = mins;
+
+	for (const hint_node_t &node : hint_graph.nodes)
+		for (int axis = 0; axis < 3; axis++)
+		{
+			mins[axis] = min(mins[axis], node.ent->s.origin[axis]);
+			maxs[axis] = max(maxs[axis], node.ent->s.origin[axis]);
+		}
+
+	hint_graph.grid_mins = mins;
+
+	for (int axis = 0; axis < 3; axis++)
+		hint_graph.grid_size[axis] = (int32_t) ((maxs[axis] - mins[axis]) / HINT_NODE_RANGE) + 1;
+
+	hint_graph.cell_start.assign(hint_graph.grid_size[0] * hint_graph.grid_size[1] * hint_graph.grid_size[2] + 1, 0);
+	hint_graph.cell_nodes.resize(hint_graph.nodes.size());
+
+	for (const hint_node_t &node : hint_graph.nodes)
+		hint_graph.cell_start[HintGraph_Cell(node.ent->s.origin) + 1]++;
+
+	for (size_t i = 1; i < hint_graph.cell_start.size(); i++)
+		hint_graph.cell_start[i] += hint_graph.cell_start[i - 1];
+
+	std::vector<int32_t> fill(hint_graph.cell_start.begin(), hint_graph.cell_start.end() - 1);
+
+	for (size_t i = 0; i < hint_graph.nodes.size(); i++)
+		hint_graph.cell_nodes[fill[HintGraph_Cell(hint_graph.nodes[i].ent->s.origin)]++] = (int32_t) i;
+}
+
+static int32_t HintGraph_NodeFor(edict_t *ent)
+{
+	if (!ent || (size_t) ent->s.number >= hint_graph.node_of_edict.size())
+		return -1;
+
+	return hint_graph.node_of_edict[ent->s.number];
+}
+
+// fills out with every node within HINT_NODE_RANGE of origin
+static void HintGraph_NodesInRange(const vec3_t &origin, std::vector<int32_t> &out)
+{
+	out.clear();
+
+	if (hint_graph.nodes.empty())
+		return;
+
+	vec3_t  range { HINT_NODE_RANGE, HINT_NODE_RANGE, HINT_NODE_RANGE };
+	int32_t lo[3], hi[3];
+
+	for (int axis = 0; axis < 3; axis++)
+	{
+		lo[axis] = HintGraph_CellAxis(origin - range, axis);
+		hi[axis] = HintGraph_CellAxis(origin + range, axis);
+	}
+
+	for (int32_t z = lo[2]; z <= hi[2]; z++)
+		for (int32_t y = lo[1]; y <= hi[1]; y++)
+			for (int32_t x = lo[0]; x <= hi[0]; x++)
+			{
+				int32_t cell = x + (y + z * hint_graph.grid_size[1]) * hint_graph.grid_size[0];
+
+				for (int32_t i = hint_graph.cell_start[cell]; i < hint_graph.cell_start[cell + 1]; i++)
+				{
+					int32_t n = hint_graph.cell_nodes[i];
+
+					if ((hint_graph.nodes[n].ent->s.origin - origin).length() <= HINT_NODE_RANGE)
+						out.push_back(n);
+				}
+			}
+}
+
+static bool HintGraph_EnemyCanSee(hint_node_t &node, edict_t *enemy)
+{
+	if (node.vis_enemy != enemy || node.vis_time != level.time)
+	{
+		node.vis_enemy = enemy;
+		node.vis_time = level.time;
+		node.vis_result = visible(enemy, node.ent);
+	}
+
+	return node.vis_result;
+}
+
 //
 // AI code
 //
@@ -413,14 +580,10 @@ void hintpath_stop(edict_t *self)
 // =============
 bool monsterlost_checkhint(edict_t *self)
 {
-	edict_t *e, *monster_pathchain, *target_pathchain, *checkpoint = nullptr;
-	edict_t *closest;
-	float	 closest_range = 1000000;
-	edict_t *start, *destination;
-	int		 count5 = 0;
-	float	 r;
-	int		 i;
-	bool	 hint_path_represented[MAX_HINT_CHAINS];
+	static std::vector<int32_t> monster_nodes, target_nodes;
+	bool						monster_chains[MAX_HINT_CHAINS] {}, target_chains[MAX_HINT_CHAINS] {};
+	int32_t						start, destination;
+	float						r, closest_range;
 
 	// if there are no hint paths on this map, exit immediately.
 	if (!hint_paths_present)
@@ -436,280 +599,77 @@ bool monsterlost_checkhint(edict_t *self)
 	if (!strcmp(self->classname, "monster_turret"))
 		return false;
 
-	monster_pathchain = nullptr;
+	// "monster valid" nodes: in range of, and visible to, the monster
+	HintGraph_NodesInRange(self->s.origin, monster_nodes);
 
-	// find all the hint_paths.
-	// FIXME - can we not do this every time?
-	for (i = 0; i < num_hint_paths; i++)
-	{
-		e = hint_path_start[i];
-		while (e)
-		{
-			if (e->monster_hint_chain)
-				e->monster_hint_chain = nullptr;
+	auto monster_end = std::remove_if(monster_nodes.begin(), monster_nodes.end(), [self](int32_t n) {
+		return !visible(self, hint_graph.nodes[n].ent);
+	});
+	monster_nodes.erase(monster_end, monster_nodes.end());
 
-			if (monster_pathchain)
-			{
-				checkpoint->monster_hint_chain = e;
-				checkpoint = e;
-			}
-			else
-			{
-				monster_pathchain = e;
-				checkpoint = e;
-			}
-			e = e->hint_chain;
-		}
-	}
+	if (monster_nodes.empty())
+		return false;
 
-	// filter them by distance and visibility to the monster
-	e = monster_pathchain;
-	checkpoint = nullptr;
-	while (e)
-	{
-		r = realrange(self, e);
+	for (int32_t n : monster_nodes)
+		monster_chains[hint_graph.nodes[n].chain] = true;
 
-		if (r > 512)
-		{
-			if (checkpoint)
-			{
-				checkpoint->monster_hint_chain = e->monster_hint_chain;
-				e->monster_hint_chain = nullptr;
-				e = checkpoint->monster_hint_chain;
-				continue;
-			}
-			else
-			{
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->monster_hint_chain;
-				checkpoint->monster_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				// since we have yet to find a valid one (or else checkpoint would be set) move the
-				// start of monster_pathchain
-				monster_pathchain = e;
-				continue;
-			}
-		}
-		if (!visible(self, e))
-		{
-			if (checkpoint)
-			{
-				checkpoint->monster_hint_chain = e->monster_hint_chain;
-				e->monster_hint_chain = nullptr;
-				e = checkpoint->monster_hint_chain;
-				continue;
-			}
-			else
-			{
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->monster_hint_chain;
-				checkpoint->monster_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				// since we have yet to find a valid one (or else checkpoint would be set) move the
-				// start of monster_pathchain
-				monster_pathchain = e;
-				continue;
-			}
-		}
+	// "target valid" nodes: on one of those chains, and in range of and visible to the enemy
+	HintGraph_NodesInRange(self->enemy->s.origin, target_nodes);
 
-		count5++;
-		checkpoint = e;
-		e = e->monster_hint_chain;
-	}
+	auto target_end = std::remove_if(target_nodes.begin(), target_nodes.end(), [self, &monster_chains](int32_t n) {
+		return !monster_chains[hint_graph.nodes[n].chain] || !HintGraph_EnemyCanSee(hint_graph.nodes[n], self->enemy);
+	});
+	target_nodes.erase(target_end, target_nodes.end());
 
-	// at this point, we have a list of all of the eligible hint nodes for the monster
-	// we now take them, figure out what hint chains they're on, and traverse down those chains,
-	// seeing whether any can see the player
-	//
-	// first, we figure out which hint chains we have represented in monster_pathchain
-	if (count5 == 0)
+	if (target_nodes.empty())
 		return false;
 
-	for (i = 0; i < num_hint_paths; i++)
-		hint_path_represented[i] = false;
-
-	e = monster_pathchain;
-	checkpoint = nullptr;
-	while (e)
-	{
-		if ((e->hint_chain_id < 0) || (e->hint_chain_id > num_hint_paths))
-			return false;
+	for (int32_t n : target_nodes)
+		target_chains[hint_graph.nodes[n].chain] = true;
 
-		hint_path_represented[e->hint_chain_id] = true;
-		e = e->monster_hint_chain;
-	}
+	// the closest "monster valid" node that shares a chain with a "target valid" node
+	// is the one the monster will go to
+	start = -1;
+	closest_range = 1000000;
 
-	count5 = 0;
-
-	// now, build the target_pathchain which contains all of the hint_path nodes we need to check for
-	// validity (within range, visibility)
-	target_pathchain = nullptr;
-	checkpoint = nullptr;
-	for (i = 0; i < num_hint_paths; i++)
-	{
-		// if this hint chain is represented in the monster_hint_chain, add all of it's nodes to the target_pathchain
-		// for validity checking
-		if (hint_path_represented[i])
-		{
-			e = hint_path_start[i];
-			while (e)
-			{
-				if (target_pathchain)
-				{
-					checkpoint->target_hint_chain = e;
-					checkpoint = e;
-				}
-				else
-				{
-					target_pathchain = e;
-					checkpoint = e;
-				}
-				e = e->hint_chain;
-			}
-		}
-	}
-
-	// target_pathchain is a list of all of the hint_path nodes we need to check for validity relative to the target
-	e = target_pathchain;
-	checkpoint = nullptr;
-	while (e)
+	for (int32_t n : monster_nodes)
 	{
-		r = realrange(self->enemy, e);
+		if (!target_chains[hint_graph.nodes[n].chain])
+			continue;
 
-		if (r > 512)
-		{
-			if (checkpoint)
-			{
-				checkpoint->target_hint_chain = e->target_hint_chain;
-				e->target_hint_chain = nullptr;
-				e = checkpoint->target_hint_chain;
-				continue;
-			}
-			else
-			{
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->target_hint_chain;
-				checkpoint->target_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				target_pathchain = e;
-				continue;
-			}
-		}
-		if (!visible(self->enemy, e))
+		r = realrange(self, hint_graph.nodes[n].ent);
+		if (r < closest_range)
 		{
-			if (checkpoint)
-			{
-				checkpoint->target_hint_chain = e->target_hint_chain;
-				e->target_hint_chain = nullptr;
-				e = checkpoint->target_hint_chain;
-				continue;
-			}
-			else
-			{
-				// use checkpoint as temp pointer
-				checkpoint = e;
-				e = e->target_hint_chain;
-				checkpoint->target_hint_chain = nullptr;
-				// and clear it again
-				checkpoint = nullptr;
-				target_pathchain = e;
-				continue;
-			}
+			start = n;
+			closest_range = r;
 		}
-
-		count5++;
-		checkpoint = e;
-		e = e->target_hint_chain;
 	}
 
-	// at this point we should have:
-	// monster_pathchain - a list of "monster valid" hint_path nodes linked together by monster_hint_chain
-	// target_pathcain - a list of "target valid" hint_path nodes linked together by target_hint_chain.  these
-	//                   are filtered such that only nodes which are on the same chain as "monster valid" nodes
-	//
-	// Now, we figure out which "monster valid" node we want to use
-	//
-	// To do this, we first off make sure we have some target nodes.  If we don't, there are no valid hint_path nodes
-	// for us to take
-	//
-	// If we have some, we filter all of our "monster valid" nodes by which ones have "target valid" nodes on them
-	//
-	// Once this filter is finished, we select the closest "monster valid" node, and go to it.
-
-	if (count5 == 0)
+	if (start == -1)
 		return false;
 
-	// reuse the hint_chain_represented array, this time to see which chains are represented by the target
-	for (i = 0; i < num_hint_paths; i++)
-		hint_path_represented[i] = false;
-
-	e = target_pathchain;
-	checkpoint = nullptr;
-	while (e)
-	{
-		if ((e->hint_chain_id < 0) || (e->hint_chain_id > num_hint_paths))
-			return false;
-
-		hint_path_represented[e->hint_chain_id] = true;
-		e = e->target_hint_chain;
-	}
+	// and the closest "target valid" node on that chain is where it's headed
+	destination = -1;
+	closest_range = 10000000;
 
-	// traverse the monster_pathchain - if the hint_node isn't represented in the "target valid" chain list,
-	// remove it
-	// if it is on the list, check it for range from the monster.  If the range is the closest, keep it
-	//
-	closest = nullptr;
-	e = monster_pathchain;
-	while (e)
+	for (int32_t n : target_nodes)
 	{
-		if (!(hint_path_represented[e->hint_chain_id]))
-		{
-			checkpoint = e->monster_hint_chain;
-			e->monster_hint_chain = nullptr;
-			e = checkpoint;
+		if (hint_graph.nodes[n].chain != hint_graph.nodes[start].chain)
 			continue;
-		}
-		r = realrange(self, e);
-		if (r < closest_range)
-			closest = e;
-		e = e->monster_hint_chain;
-	}
-
-	if (!closest)
-		return false;
 
-	start = closest;
-	// now we know which one is the closest to the monster .. this is the one the monster will go to
-	// we need to finally determine what the DESTINATION node is for the monster .. walk down the hint_chain,
-	// and find the closest one to the player
-
-	closest = nullptr;
-	closest_range = 10000000;
-	e = target_pathchain;
-	while (e)
-	{
-		if (start->hint_chain_id == e->hint_chain_id)
+		r = realrange(self, hint_graph.nodes[n].ent);
+		if (r < closest_range)
 		{
-			r = realrange(self, e);
-			if (r < closest_range)
-				closest = e;
+			destination = n;
+			closest_range = r;
 		}
-		e = e->target_hint_chain;
 	}
 
-	if (!closest)
+	if (destination == -1)
 		return false;
 
-	destination = closest;
-
-	self->monsterinfo.goal_hint = destination;
-	hintpath_go(self, start);
+	self->monsterinfo.goal_hint = hint_graph.nodes[destination].ent;
+	hintpath_go(self, hint_graph.nodes[start].ent);
 
 	return true;
 }
@@ -723,9 +683,7 @@ bool monsterlost_checkhint(edict_t *self)
 // =============
 TOUCH(hint_path_touch) (edict_t *self, edict_t *other, const trace_t &tr, bool other_touching_self) -> void
 {
-	edict_t *e, *goal, *next = nullptr;
-	//	int			chain;			 // direction - (-1) = upstream, (1) = downstream, (0) = done
-	bool goalFound = false;
+	edict_t *goal, *next = nullptr;
 
 	// make sure we're the target of it's obsession
 	if (other->movetarget == self)
@@ -741,25 +699,20 @@ TOUCH(hint_path_touch) (edict_t *self, edict_t *other, const trace_t &tr, bool o
 		else
 		{
 			// if we aren't, figure out which way we want to go
-			e = hint_path_start[self->hint_chain_id];
-			while (e)
+			int32_t node = HintGraph_NodeFor(self);
+			int32_t goal_node = HintGraph_NodeFor(goal);
+
+			if (node != -1)
 			{
-				// if we get up to ourselves on the hint chain, we're going down it
-				if (e == self)
-				{
-					next = e->hint_chain;
-					break;
-				}
-				if (e == goal)
-					goalFound = true;
-				// if we get to where the next link on the chain is this hint_path and have found the goal on the way
-				// we're going upstream, so remember who the previous link is
-				if ((e->hint_chain == self) && goalFound)
-				{
-					next = e;
-					break;
-				}
-				e = e->hint_chain;
+				const hint_node_t &n = hint_graph.nodes[node];
+
+				// if the goal is before us on the chain we're going upstream,
+				// otherwise we're going down it
+				if (goal_node != -1 && hint_graph.nodes[goal_node].chain == n.chain &&
+					hint_graph.nodes[goal_node].position < n.position)
+					next = hint_graph.nodes[n.prev].ent;
+				else if (n.next != -1)
+					next = hint_graph.nodes[n.next].ent;
 			}
 		}
 
@@ -819,6 +772,8 @@ void InitHintPaths()
 	int		 i;
 
 	hint_paths_present = 0;
+	num_hint_paths = 0;
+	HintGraph_Build();
 
 	// check all the hint_paths.
 	e = G_FindByString<&edict_t::classname>(nullptr, "hint_path");
@@ -888,6 +843,8 @@ void InitHintPaths()
 			}
 		}
 	}
+
+	HintGraph_Build();
 }
 
 // *****************************
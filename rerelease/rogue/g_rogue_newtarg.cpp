@@ -152,6 +152,7 @@ USE(target_anger_use) (edict_t *self, edict_t *other, edict_t *activator) -> voi
 		{
 			target->monsterinfo.aiflags |= AI_GOOD_GUY | AI_DO_NOT_COUNT;
 			target->svflags |= SVF_MONSTER;
+			G_EdictHot_Sync(target);
 			target->health = 300;
 		}
 
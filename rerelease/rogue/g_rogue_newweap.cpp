@@ -48,6 +48,7 @@ void fire_flechette(edict_t *self, const vec3_t &start, const vec3_t &dir, int d
 	flechette->s.angles = vectoangles(dir);
 	flechette->velocity = dir * speed;
 	flechette->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(flechette);
 	flechette->movetype = MOVETYPE_FLYMISSILE;
 	flechette->clipmask = MASK_PROJECTILE;
 	flechette->flags |= FL_DODGE;
@@ -204,9 +205,9 @@ THINK(prox_seek) (edict_t *ent) -> void
 //===============
 THINK(prox_open) (edict_t *ent) -> void
 {
+	static edict_t *touch[MAX_EDICTS];
 	edict_t *search;
-
-	search = nullptr;
+	size_t	 i, num;
 
 	if (ent->s.frame == 9) // end of opening animation
 	{
@@ -219,8 +220,11 @@ THINK(prox_open) (edict_t *ent) -> void
 
 		if (ent->teamchain)
 			ent->teamchain->touch = Prox_Field_Touch;
-		while ((search = findradius(search, ent->s.origin, PROX_DAMAGE_RADIUS + 10)) != nullptr)
+		num = G_FindRadiusLinked(ent->s.origin, PROX_DAMAGE_RADIUS + 10, touch, MAX_EDICTS);
+		for (i = 0; i < num; i++)
 		{
+			search = touch[i];
+
 			if (!search->classname) // tag token and other weird shit
 				continue;
 			
@@ -451,6 +455,7 @@ void fire_prox(edict_t *self, const vec3_t &start, const vec3_t &aimdir, int pro
 	prox->movetype = MOVETYPE_BOUNCE;
 	prox->solid = SOLID_BBOX;
 	prox->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(prox);
 	prox->s.effects |= EF_GRENADE;
 	prox->flags |= ( FL_DODGE | FL_TRAP );
 	prox->clipmask = MASK_PROJECTILE | CONTENTS_LAVA | CONTENTS_SLIME;
@@ -610,7 +615,7 @@ THINK(Nuke_Quake) (edict_t *self) -> void
 		self->last_move_time = level.time + 500_ms;
 	}
 
-	for (i = 1, e = g_edicts + i; i < globals.num_edicts; i++, e++)
+	for (i = 1, e = g_edicts + i; i <= game.maxclients; i++, e++)
 	{
 		if (!e->inuse)
 			continue;
@@ -978,6 +983,7 @@ THINK(tesla_think_active) (edict_t *self) -> void
 
 THINK(tesla_activate) (edict_t *self) -> void
 {
+	static edict_t *touch[MAX_EDICTS];
 	edict_t *trigger;
 	edict_t *search;
 
@@ -990,9 +996,11 @@ THINK(tesla_activate) (edict_t *self) -> void
 	// only check for spawn points in deathmatch
 	if (deathmatch->integer)
 	{
-		search = nullptr;
-		while ((search = findradius(search, self->s.origin, 1.5f * TESLA_DAMAGE_RADIUS)) != nullptr)
+		size_t num = G_FindRadiusLinked(self->s.origin, 1.5f * TESLA_DAMAGE_RADIUS, touch, MAX_EDICTS);
+		for (size_t i = 0; i < num; i++)
 		{
+			search = touch[i];
+
 			// [Paril-KEX] don't allow traps to be placed near flags or teleporters
 			// if it's a monster or player with health > 0
 			// or it's a player start point
@@ -1185,7 +1193,7 @@ static void fire_beams(edict_t *self, const vec3_t &start, const vec3_t &aimdir,
 		content_mask &= ~MASK_WATER;
 	}
 
-	tr = gi.traceline(start, end, self, content_mask);
+	tr = G_LagTraceLine(start, end, self, content_mask);
 
 	// see if we hit water
 	if (tr.contents & MASK_WATER)
@@ -1205,7 +1213,7 @@ static void fire_beams(edict_t *self, const vec3_t &start, const vec3_t &aimdir,
 			gi.multicast(tr.endpos, MULTICAST_PVS, false);
 		}
 		// re-trace ignoring water this time
-		tr = gi.traceline(water_start, end, self, content_mask & ~MASK_WATER);
+		tr = G_LagTraceLine(water_start, end, self, content_mask & ~MASK_WATER);
 	}
 	endpoint = tr.endpos;
 	//	}
@@ -1382,6 +1390,7 @@ void fire_blaster2(edict_t *self, const vec3_t &start, const vec3_t &dir, int da
 	bolt->s.angles = vectoangles(dir);
 	bolt->velocity = dir * speed;
 	bolt->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(bolt);
 	bolt->movetype = MOVETYPE_FLYMISSILE;
 	bolt->clipmask = MASK_PROJECTILE;
 	bolt->flags |= FL_DODGE;
@@ -1607,6 +1616,7 @@ void fire_tracker(edict_t *self, const vec3_t &start, const vec3_t &dir, int dam
 	bolt->s.angles = vectoangles(dir);
 	bolt->velocity = dir * speed;
 	bolt->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(bolt);
 	bolt->movetype = MOVETYPE_FLYMISSILE;
 	bolt->clipmask = MASK_PROJECTILE;
 
@@ -209,7 +209,7 @@ void weapon_tracker_fire(edict_t *self)
 		mask &= ~CONTENTS_PLAYER;
 
 	G_LagCompensate(self, start, dir);
-	tr = gi.traceline(start, end, self, mask);
+	tr = G_LagTraceLine(start, end, self, mask);
 	G_UnLagCompensate();
 	if (tr.ent != world)
 	{
@@ -15,6 +15,7 @@ void fire_blueblaster(edict_t *self, const vec3_t &start, const vec3_t &dir, int
 	bolt->s.angles = vectoangles(dir);
 	bolt->velocity = dir * speed;
 	bolt->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(bolt);
 	bolt->movetype = MOVETYPE_FLYMISSILE;
 	bolt->flags |= FL_DODGE;
 	bolt->clipmask = MASK_PROJECTILE;
@@ -108,6 +109,7 @@ void fire_ionripper(edict_t *self, const vec3_t &start, const vec3_t &dir, int d
 	ion->solid = SOLID_BBOX;
 	ion->s.effects |= effect;
 	ion->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(ion);
 	ion->flags |= FL_DODGE;
 	ion->s.renderfx |= RF_FULLBRIGHT;
 	ion->s.modelindex = gi.modelindex("models/objects/boomrang/tris.md2");
@@ -216,6 +218,7 @@ void fire_heat(edict_t *self, const vec3_t &start, const vec3_t &dir, int damage
 	heat->flags |= FL_DODGE;
 	heat->movetype = MOVETYPE_FLYMISSILE;
 	heat->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(heat);
 	heat->clipmask = MASK_PROJECTILE;
 	heat->solid = SOLID_BBOX;
 	heat->s.effects |= EF_ROCKET;
@@ -295,6 +298,7 @@ void fire_plasma(edict_t *self, const vec3_t &start, const vec3_t &dir, int dama
 
 	plasma->solid = SOLID_BBOX;
 	plasma->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(plasma);
 	plasma->flags |= FL_DODGE;
 	plasma->owner = self;
 	plasma->touch = plasma_touch;
@@ -357,8 +361,10 @@ void SpawnDamage(int type, const vec3_t &origin, const vec3_t &normal, int damag
 // RAFAEL
 THINK(Trap_Think) (edict_t *ent) -> void
 {
-	edict_t *target = nullptr;
+	static edict_t *touch[MAX_EDICTS];
+	edict_t *target;
 	edict_t *best = nullptr;
+	size_t	 num;
 	vec3_t	 vec;
 	float	 len;
 	float	 oldlen = 8000;
@@ -437,8 +443,11 @@ THINK(Trap_Think) (edict_t *ent) -> void
 		return;
 	}
 
-	while ((target = findradius(target, ent->s.origin, 256)) != nullptr)
+	num = G_FindRadiusLinked(ent->s.origin, 256, touch, MAX_EDICTS);
+	for (size_t i = 0; i < num; i++)
 	{
+		target = touch[i];
+
 		if (target == ent)
 			continue;
 		
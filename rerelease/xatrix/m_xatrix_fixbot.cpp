@@ -59,10 +59,12 @@ void ED_CallSpawn(edict_t *ent);
 
 edict_t *fixbot_FindDeadMonster(edict_t *self)
 {
-	edict_t *ent = nullptr;
+	static std::vector<edict_t *> corpses;
 	edict_t *best = nullptr;
 
-	while ((ent = findradius(ent, self->s.origin, 1024)) != nullptr)
+	G_FindCorpses(self->s.origin, 1024, corpses);
+
+	for (edict_t *ent : corpses)
 	{
 		if (ent == self)
 			continue;
@@ -1000,7 +1002,7 @@ void fixbot_fire_laser(edict_t *self)
 			int32_t old_gib_health = self->enemy->gib_health;
 
 			st = {};
-			st.keys_specified.emplace("reinforcements");
+			st.mark_key_specified("reinforcements");
 			st.reinforcements = "";
 
 			ED_CallSpawn(self->enemy);
@@ -1011,6 +1013,7 @@ void fixbot_fire_laser(edict_t *self)
 
 			self->enemy->gib_health = old_gib_health / 2;
 			self->enemy->health = self->enemy->max_health = old_max_health;
+			G_Corpse_Remove(self->enemy);
 			self->enemy->monsterinfo.power_armor_power = self->enemy->monsterinfo.max_power_armor_power = old_power_armor_power;
 			self->enemy->monsterinfo.power_armor_type = self->enemy->monsterinfo.initial_power_armor_type = old_power_armor_type;
 			self->enemy->monsterinfo.base_health = old_base_health;
@@ -708,6 +708,7 @@ void fire_loogie(edict_t *self, const vec3_t &start, const vec3_t &dir, int dama
 	loogie->think = G_FreeEdict;
 	loogie->dmg = damage;
 	loogie->svflags |= SVF_PROJECTILE;
+	G_EdictHot_Sync(loogie);
 	gi.linkentity(loogie);
 
 	tr = gi.traceline(self->s.origin, loogie->s.origin, loogie, MASK_PROJECTILE);